@@ -468,6 +468,11 @@ def generate_builtin_class_header(builtin_api, size, used_classes, fully_used_cl
     # Move constructor.
     result.append(f"\t{class_name}({class_name} &&other);")
 
+    # Zeroed opaque data is a valid empty value for these types (same assumption as the move constructor),
+    # which lets ptrcalls write their return value into it without constructing it through the engine first.
+    if not needs_copy_instead_of_move(class_name):
+        result.append(f"\t{class_name}(internal::NoInitTag) {{}}")
+
     # Special cases.
     if class_name == "String" or class_name == "StringName" or class_name == "NodePath":
         result.append(f"\t{class_name}(const char *from);")
@@ -540,7 +545,13 @@ def generate_builtin_class_header(builtin_api, size, used_classes, fully_used_cl
         result.append("\tChar16String utf16() const;")
         result.append("\tChar32String utf32() const;")
         result.append("\tCharWideString wide_string() const;")
+        result.append("\tint64_t utf8_into(char *r_buffer, int64_t p_capacity) const;")
+        result.append("\tint64_t utf16_into(char16_t *r_buffer, int64_t p_capacity) const;")
         result.append("\tstatic String num_real(double p_num, bool p_trailing = true);")
+        result.append("\tstatic int64_t to_int(const char *p_str, int p_len = -1);")
+        result.append("\tstatic int64_t to_int(const char32_t *p_str, int p_len = -1, bool p_clamp = false);")
+        result.append("\tstatic double to_float(const char *p_str);")
+        result.append("\tstatic double to_float(const char32_t *p_str);")
 
     if "members" in builtin_api:
         for member in builtin_api["members"]:
@@ -1190,6 +1201,18 @@ def generate_engine_class_header(class_api, used_classes, fully_used_classes, us
     if is_singleton:
         result.append(f"\tstatic {class_name} *get_singleton();")
         result.append("")
+    # The hashes classdb_get_method_bind() checks, for looking methods up outside the generated wrappers
+    # (MethodBatch). They build on the base class ones, so inherited methods are found too.
+    if "inherits" in class_api:
+        result.append(f"\tstruct MethodHash : public {class_api['inherits']}::MethodHash {{")
+    else:
+        result.append("\tstruct MethodHash {")
+    if "methods" in class_api:
+        for method in class_api["methods"]:
+            if not method["is_virtual"]:
+                result.append(f'\t\tstatic constexpr GDNativeInt {escape_identifier(method["name"])} = {method["hash"]};')
+    result.append("\t};")
+    result.append("")
 
     if "methods" in class_api:
         for method in class_api["methods"]:
@@ -1257,6 +1280,11 @@ def generate_engine_class_header(class_api, used_classes, fully_used_classes, us
         result.append("\ttemplate<class T>")
         result.append("\tstatic const T *cast_to(const Object *p_object);")
 
+        result.append("\ttemplate<class T>")
+        result.append("\tstatic bool is_exact_class(const Object *p_object);")
+
+        result.append("\tError emit_signal_packed(const Variant **p_args, GDNativeInt p_arg_count) { return emit_signal_internal(p_args, p_arg_count); }")
+
         result.append("\tvirtual ~Object() = default;")
 
     elif use_template_get_node and class_name == "Node":
@@ -1313,9 +1341,8 @@ def generate_engine_class_source(class_api, used_classes, fully_used_classes, us
 
     if is_singleton:
         result.append(f"{class_name} *{class_name}::get_singleton() {{")
-        result.append(f"\tconst StringName __class_name = {class_name}::get_class_static();")
         result.append(
-            f"\tstatic GDNativeObjectPtr singleton_obj = internal::gdn_interface->global_get_singleton(__class_name._native_ptr());"
+            f"\tstatic GDNativeObjectPtr singleton_obj = internal::gdn_interface->global_get_singleton({class_name}::get_class_static()._native_ptr());"
         )
         result.append("#ifdef DEBUG_ENABLED")
         result.append("\tERR_FAIL_COND_V(singleton_obj == nullptr, nullptr);")
@@ -1340,10 +1367,10 @@ def generate_engine_class_source(class_api, used_classes, fully_used_classes, us
             result.append(method_signature + " {")
 
             # Method body.
-            result.append(f"\tconst StringName __class_name = {class_name}::get_class_static();")
-            result.append(f'\tconst StringName __method_name = "{method["name"]}";')
+            # The names are only needed to look up the bind, so keep them inside the static initializer
+            # instead of building (and copying) StringNames on every call.
             result.append(
-                f'\tstatic GDNativeMethodBindPtr ___method_bind = internal::gdn_interface->classdb_get_method_bind(__class_name._native_ptr(), __method_name._native_ptr(), {method["hash"]});'
+                f'\tstatic GDNativeMethodBindPtr ___method_bind = internal::gdn_interface->classdb_get_method_bind({class_name}::get_class_static()._native_ptr(), StringName("{method["name"]}")._native_ptr(), {method["hash"]});'
             )
             method_call = "\t"
             has_return = "return_value" in method and method["return_value"]["type"] != "void"
@@ -1590,9 +1617,8 @@ def generate_utility_functions(api, output_dir):
 
         # Function body.
 
-        source.append(f'\tconst StringName __function_name = "{function["name"]}";')
         source.append(
-            f'\tstatic GDNativePtrUtilityFunction ___function = internal::gdn_interface->variant_get_ptr_utility_function(__function_name._native_ptr(), {function["hash"]});'
+            f'\tstatic GDNativePtrUtilityFunction ___function = internal::gdn_interface->variant_get_ptr_utility_function(StringName("{function["name"]}")._native_ptr(), {function["hash"]});'
         )
         has_return = "return_type" in function and function["return_type"] != "void"
         if has_return:
@@ -39,6 +39,8 @@
 #include <godot_cpp/core/memory.hpp>
 #include <godot_cpp/variant/variant.hpp>
 
+#include <type_traits>
+
 namespace godot {
 
 // Helper class for RefCounted objects, same as Godot one.
@@ -70,6 +72,16 @@ class Ref {
 		}
 	}
 
+	// Upcasts are resolved at compile time, only downcasts have to go through Object::cast_to().
+	template <class T_Other>
+	static _FORCE_INLINE_ T *_cast_from(T_Other *p_ptr) {
+		if constexpr (std::is_base_of_v<T, T_Other>) {
+			return p_ptr;
+		} else {
+			return Object::cast_to<T>(p_ptr);
+		}
+	}
+
 public:
 	_FORCE_INLINE_ bool operator==(const T *p_ptr) const {
 		return reference == p_ptr;
@@ -128,7 +140,7 @@ public:
 		}
 
 		Ref r;
-		r.reference = Object::cast_to<T>(refb);
+		r.reference = _cast_from(const_cast<T_Other *>(p_from.ptr()));
 		ref(r);
 		r.reference = nullptr;
 	}
@@ -162,7 +174,7 @@ public:
 		}
 		unref();
 
-		T *r = Object::cast_to<T>(p_ptr);
+		T *r = _cast_from(p_ptr);
 		if (r) {
 			ref_pointer(r);
 		}
@@ -181,7 +193,7 @@ public:
 		}
 
 		Ref r;
-		r.reference = Object::cast_to<T>(refb);
+		r.reference = _cast_from(const_cast<T_Other *>(p_from.ptr()));
 		ref(r);
 		r.reference = nullptr;
 	}
@@ -240,7 +252,7 @@ public:
 template <class T>
 struct PtrToArg<Ref<T>> {
 	_FORCE_INLINE_ static Ref<T> convert(const void *p_ptr) {
-		return Ref<T>(reinterpret_cast<T *>(godot::internal::gdn_interface->object_get_instance_binding(*reinterpret_cast<GDNativeObjectPtr *>(const_cast<void *>(p_ptr)), godot::internal::token, &T::___binding_callbacks)));
+		return Ref<T>(reinterpret_cast<T *>(godot::internal::InstanceBindingCache::get(*reinterpret_cast<GDNativeObjectPtr *>(const_cast<void *>(p_ptr)), &T::___binding_callbacks)));
 	}
 
 	typedef Ref<T> EncodeT;
@@ -255,7 +267,7 @@ struct PtrToArg<const Ref<T> &> {
 	typedef Ref<T> EncodeT;
 
 	_FORCE_INLINE_ static Ref<T> convert(const void *p_ptr) {
-		return Ref<T>(reinterpret_cast<T *>(godot::internal::gdn_interface->object_get_instance_binding(*reinterpret_cast<GDNativeObjectPtr *>(const_cast<void *>(p_ptr)), godot::internal::token, &T::___binding_callbacks)));
+		return Ref<T>(reinterpret_cast<T *>(godot::internal::InstanceBindingCache::get(*reinterpret_cast<GDNativeObjectPtr *>(const_cast<void *>(p_ptr)), &T::___binding_callbacks)));
 	}
 };
 
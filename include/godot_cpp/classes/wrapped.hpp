@@ -31,18 +31,56 @@
 #ifndef GODOT_WRAPPED_HPP
 #define GODOT_WRAPPED_HPP
 
+#include <godot_cpp/core/instance_binding_cache.hpp>
+#include <godot_cpp/core/instance_pool.hpp>
 #include <godot_cpp/core/memory.hpp>
+#include <godot_cpp/core/notification_dispatch.hpp>
 
+#include <godot_cpp/core/property_accessor.hpp>
 #include <godot_cpp/core/property_info.hpp>
 
 #include <godot_cpp/templates/list.hpp>
 
+#include <godot_cpp/variant/sname.hpp>
+#include <godot_cpp/variant/string_builder.hpp>
+
 #include <godot_cpp/godot.hpp>
 
+#include <type_traits>
+
 namespace godot {
 
 typedef void GodotObject;
 
+namespace internal {
+
+// Property list of one extension class instance, kept between engine queries once the class calls
+// set_property_list_cached(). It is a GDCLASS member, engine classes don't carry it.
+struct PropertyListCache {
+	List<PropertyInfo> owned;
+	GDNativePropertyInfo *list = nullptr;
+	uint32_t size = 0;
+	bool enabled = false;
+	bool dirty = true;
+
+	// Fills the list handed to the engine from the PropertyInfos in owned.
+	void build();
+	void clear();
+
+	PropertyListCache() {}
+	// A copy starts empty, the list belongs to the instance it was built for.
+	PropertyListCache(const PropertyListCache &p_other) :
+			enabled(p_other.enabled) {}
+	PropertyListCache &operator=(const PropertyListCache &p_other) {
+		clear();
+		enabled = p_other.enabled;
+		return *this;
+	}
+	~PropertyListCache() { clear(); }
+};
+
+} // namespace internal
+
 // Base for all engine classes, to contain the pointer to the engine instance.
 class Wrapped {
 	friend class GDExtensionBinding;
@@ -58,7 +96,7 @@ protected:
 	void _get_property_list(List<PropertyInfo> *p_list) const {}
 	bool _property_can_revert(const StringName &p_name) const { return false; }
 	bool _property_get_revert(const StringName &p_name, Variant &r_property) const { return false; }
-	String _to_string() const { return "[" + String(get_class_static()) + ":" + itos(get_instance_id()) + "]"; }
+	String _to_string() const { return StringBuilder().append("[").append(String(get_class_static())).append(":").append_uint(get_instance_id()).append("]"); }
 
 	static void notification_bind(GDExtensionClassInstancePtr p_instance, int32_t p_what) {}
 	static GDNativeBool set_bind(GDExtensionClassInstancePtr p_instance, GDNativeConstStringNamePtr p_name, GDNativeConstVariantPtr p_value) { return false; }
@@ -79,9 +117,8 @@ protected:
 	Wrapped(GodotObject *p_godot_object);
 
 public:
-	static StringName &get_class_static() {
-		static StringName string_name = StringName("Wrapped");
-		return string_name;
+	static const StringName &get_class_static() {
+		return SNAME("Wrapped");
 	}
 
 	uint64_t get_instance_id() const {
@@ -99,10 +136,35 @@ private:
 	void operator=(const m_class &p_rval) {}                                                                                                                                           \
 	friend class ::godot::ClassDB;                                                                                                                                                     \
                                                                                                                                                                                        \
+	/* Assigned once by ClassDB::register_class(), so reading the class name doesn't go through a guarded static. */                                                                   \
+	static inline const ::godot::StringName *___class_name = nullptr;                                                                                                                  \
+	static constexpr const char *___class_name_str = #m_class;                                                                                                                         \
+                                                                                                                                                                                       \
+	/* Also assigned at registration, the accessors bound with ClassDB::bind_property_accessor(). */                                                                                   \
+	static inline const ::godot::PropertyAccessorMap *___property_accessors = nullptr;                                                                                                 \
+                                                                                                                                                                                       \
+	/* And the resolved _notification() handler, see ::godot::NotificationDispatch. */                                                                                                 \
+	static inline const ::godot::NotificationDispatch *___notification_dispatch = nullptr;                                                                                             \
+                                                                                                                                                                                       \
+	/* Only used when registered with ClassDB::register_pooled_class(). */                                                                                                             \
+	static inline ::godot::InstancePool ___instance_pool;                                                                                                                              \
+                                                                                                                                                                                       \
+	::godot::internal::PropertyListCache ___property_list_cache;                                                                                                                       \
+                                                                                                                                                                                       \
 protected:                                                                                                                                                                             \
+	/* Keeps the list built by _get_property_list() and hands it to the engine again on the next queries, */                                                                           \
+	/* instead of rebuilding it every time. notify_property_list_changed() marks it for a rebuild. */                                                                                  \
+	void set_property_list_cached(bool p_cached) {                                                                                                                                     \
+		___property_list_cache.clear();                                                                                                                                                \
+		___property_list_cache.enabled = p_cached;                                                                                                                                     \
+	}                                                                                                                                                                                  \
+                                                                                                                                                                                       \
+	void invalidate_property_list_cache() {                                                                                                                                            \
+		___property_list_cache.dirty = true;                                                                                                                                           \
+	}                                                                                                                                                                                  \
+                                                                                                                                                                                       \
 	virtual const ::godot::StringName *_get_extension_class_name() const override {                                                                                                    \
-		static ::godot::StringName string_name = get_class_static();                                                                                                                   \
-		return &string_name;                                                                                                                                                           \
+		return &get_class_static();                                                                                                                                                    \
 	}                                                                                                                                                                                  \
                                                                                                                                                                                        \
 	virtual const GDNativeInstanceBindingCallbacks *_get_bindings_callbacks() const override {                                                                                         \
@@ -117,6 +179,11 @@ protected:
 		return (void(::godot::Wrapped::*)(int)) & m_class::_notification;                                                                                                              \
 	}                                                                                                                                                                                  \
                                                                                                                                                                                        \
+	/* An inherited _notification() has the type of a member of the class declaring it. */                                                                                             \
+	static constexpr bool ___has_own_notification() {                                                                                                                                  \
+		return std::is_same<decltype(&m_class::_notification), void (m_class::*)(int)>::value;                                                                                         \
+	}                                                                                                                                                                                  \
+                                                                                                                                                                                       \
 	static bool (::godot::Wrapped::*_get_set())(const ::godot::StringName &p_name, const ::godot::Variant &p_property) {                                                               \
 		return (bool(::godot::Wrapped::*)(const ::godot::StringName &p_name, const ::godot::Variant &p_property)) & m_class::_set;                                                     \
 	}                                                                                                                                                                                  \
@@ -147,6 +214,15 @@ protected:
 	}                                                                                                                                                                                  \
                                                                                                                                                                                        \
 public:                                                                                                                                                                                \
+	typedef m_class self_type;                                                                                                                                                         \
+                                                                                                                                                                                       \
+	/* Hides Object::notify_property_list_changed(), so the cached lists of this class and its parents are */                                                                          \
+	/* rebuilt before the engine queries them again. */                                                                                                                                \
+	void notify_property_list_changed() {                                                                                                                                              \
+		invalidate_property_list_cache();                                                                                                                                              \
+		m_inherits::notify_property_list_changed();                                                                                                                                    \
+	}                                                                                                                                                                                  \
+                                                                                                                                                                                       \
 	static void initialize_class() {                                                                                                                                                   \
 		static bool initialized = false;                                                                                                                                               \
 		if (initialized) {                                                                                                                                                             \
@@ -160,31 +236,47 @@ public:
 		initialized = true;                                                                                                                                                            \
 	}                                                                                                                                                                                  \
                                                                                                                                                                                        \
-	static ::godot::StringName &get_class_static() {                                                                                                                                   \
-		static ::godot::StringName string_name = ::godot::StringName(#m_class);                                                                                                        \
-		return string_name;                                                                                                                                                            \
+	static const ::godot::StringName &get_class_static() {                                                                                                                             \
+		if (unlikely(___class_name == nullptr)) {                                                                                                                                      \
+			/* Not registered (yet), e.g. used as an argument type while binding another class. */                                                                                     \
+			return SNAME(___class_name_str);                                                                                                                                           \
+		}                                                                                                                                                                              \
+		return *___class_name;                                                                                                                                                         \
 	}                                                                                                                                                                                  \
                                                                                                                                                                                        \
-	static ::godot::StringName &get_parent_class_static() {                                                                                                                            \
+	static const ::godot::StringName &get_parent_class_static() {                                                                                                                      \
 		return m_inherits::get_class_static();                                                                                                                                         \
 	}                                                                                                                                                                                  \
                                                                                                                                                                                        \
 	static GDNativeObjectPtr create(void *data) {                                                                                                                                      \
-		m_class *new_object = memnew(m_class);                                                                                                                                         \
+		m_class *new_object;                                                                                                                                                           \
+		if (___instance_pool.is_enabled()) {                                                                                                                                           \
+			void *memory = ___instance_pool.alloc();                                                                                                                                   \
+			ERR_FAIL_NULL_V(memory, nullptr);                                                                                                                                          \
+			new_object = memnew_placement(memory, m_class);                                                                                                                            \
+		} else {                                                                                                                                                                       \
+			new_object = memnew(m_class);                                                                                                                                              \
+		}                                                                                                                                                                              \
 		return new_object->_owner;                                                                                                                                                     \
 	}                                                                                                                                                                                  \
                                                                                                                                                                                        \
+	static void ___notification_call(GDExtensionClassInstancePtr p_instance, int32_t p_what) {                                                                                         \
+		reinterpret_cast<m_class *>(p_instance)->_notification(p_what);                                                                                                                \
+	}                                                                                                                                                                                  \
+                                                                                                                                                                                       \
 	static void notification_bind(GDExtensionClassInstancePtr p_instance, int32_t p_what) {                                                                                            \
-		if (p_instance && m_class::_get_notification()) {                                                                                                                              \
-			if (m_class::_get_notification() != m_inherits::_get_notification()) {                                                                                                     \
-				m_class *cls = reinterpret_cast<m_class *>(p_instance);                                                                                                                \
-				return cls->_notification(p_what);                                                                                                                                     \
-			}                                                                                                                                                                          \
-			m_inherits::notification_bind(p_instance, p_what);                                                                                                                         \
+		if (p_instance && ___notification_dispatch) {                                                                                                                                  \
+			___notification_dispatch->dispatch(p_instance, p_what);                                                                                                                    \
 		}                                                                                                                                                                              \
 	}                                                                                                                                                                                  \
                                                                                                                                                                                        \
 	static GDNativeBool set_bind(GDExtensionClassInstancePtr p_instance, GDNativeConstStringNamePtr p_name, GDNativeConstVariantPtr p_value) {                                         \
+		if (p_instance && ___property_accessors) {                                                                                                                                     \
+			const ::godot::PropertyAccessor *accessor = ::godot::internal::find_property_accessor(*___property_accessors, *reinterpret_cast<const ::godot::StringName *>(p_name));     \
+			if (accessor && accessor->set) {                                                                                                                                           \
+				return accessor->set(p_instance, *reinterpret_cast<const ::godot::Variant *>(p_value));                                                                                \
+			}                                                                                                                                                                          \
+		}                                                                                                                                                                              \
 		if (p_instance && m_class::_get_set()) {                                                                                                                                       \
 			if (m_class::_get_set() != m_inherits::_get_set()) {                                                                                                                       \
 				m_class *cls = reinterpret_cast<m_class *>(p_instance);                                                                                                                \
@@ -196,6 +288,12 @@ public:
 	}                                                                                                                                                                                  \
                                                                                                                                                                                        \
 	static GDNativeBool get_bind(GDExtensionClassInstancePtr p_instance, GDNativeConstStringNamePtr p_name, GDNativeVariantPtr r_ret) {                                                \
+		if (p_instance && ___property_accessors) {                                                                                                                                     \
+			const ::godot::PropertyAccessor *accessor = ::godot::internal::find_property_accessor(*___property_accessors, *reinterpret_cast<const ::godot::StringName *>(p_name));     \
+			if (accessor && accessor->get) {                                                                                                                                           \
+				return accessor->get(p_instance, *reinterpret_cast<::godot::Variant *>(r_ret));                                                                                        \
+			}                                                                                                                                                                          \
+		}                                                                                                                                                                              \
 		if (p_instance && m_class::_get_get()) {                                                                                                                                       \
 			if (m_class::_get_get() != m_inherits::_get_get()) {                                                                                                                       \
 				m_class *cls = reinterpret_cast<m_class *>(p_instance);                                                                                                                \
@@ -210,6 +308,17 @@ public:
 		if (p_instance && m_class::_get_get_property_list()) {                                                                                                                         \
 			if (m_class::_get_get_property_list() != m_inherits::_get_get_property_list()) {                                                                                           \
 				m_class *cls = reinterpret_cast<m_class *>(p_instance);                                                                                                                \
+				::godot::internal::PropertyListCache &cache = cls->___property_list_cache;                                                                                             \
+				if (cache.enabled) {                                                                                                                                                   \
+					if (cache.dirty) {                                                                                                                                                 \
+						cache.clear();                                                                                                                                                 \
+						cls->_get_property_list(&cache.owned);                                                                                                                         \
+						cache.build();                                                                                                                                                 \
+					}                                                                                                                                                                  \
+					if (r_count)                                                                                                                                                       \
+						*r_count = cache.size;                                                                                                                                         \
+					return cache.list;                                                                                                                                                 \
+				}                                                                                                                                                                      \
 				ERR_FAIL_COND_V_MSG(!cls->plist_owned.is_empty() || cls->plist != nullptr || cls->plist_size != 0, nullptr, "Internal error, property list was not freed by engine!"); \
 				cls->_get_property_list(&cls->plist_owned);                                                                                                                            \
 				cls->plist = reinterpret_cast<GDNativePropertyInfo *>(memalloc(sizeof(GDNativePropertyInfo) * cls->plist_owned.size()));                                               \
@@ -235,6 +344,10 @@ public:
 	static void free_property_list_bind(GDExtensionClassInstancePtr p_instance, const GDNativePropertyInfo *p_list) {                                                                  \
 		if (p_instance) {                                                                                                                                                              \
 			m_class *cls = reinterpret_cast<m_class *>(p_instance);                                                                                                                    \
+			if (p_list != nullptr && p_list == cls->___property_list_cache.list) {                                                                                                     \
+				/* Kept for the next query, released by the cache. */                                                                                                                  \
+				return;                                                                                                                                                                \
+			}                                                                                                                                                                          \
 			ERR_FAIL_COND_MSG(cls->plist == nullptr, "Internal error, property list double free!");                                                                                    \
 			memfree(cls->plist);                                                                                                                                                       \
 			cls->plist = nullptr;                                                                                                                                                      \
@@ -280,8 +393,11 @@ public:
 	static void free(void *data, GDExtensionClassInstancePtr ptr) {                                                                                                                    \
 		if (ptr) {                                                                                                                                                                     \
 			m_class *cls = reinterpret_cast<m_class *>(ptr);                                                                                                                           \
+			::godot::internal::InstanceBindingCache::invalidate(cls->_owner);                                                                                                          \
 			cls->~m_class();                                                                                                                                                           \
-			::godot::Memory::free_static(cls);                                                                                                                                         \
+			if (!___instance_pool.may_own_instances() || !___instance_pool.free(cls)) {                                                                                                \
+				::godot::Memory::free_static(cls);                                                                                                                                     \
+			}                                                                                                                                                                          \
 		}                                                                                                                                                                              \
 	}                                                                                                                                                                                  \
                                                                                                                                                                                        \
@@ -350,20 +466,21 @@ protected:
 public:                                                                                                            \
 	static void initialize_class() {}                                                                              \
                                                                                                                    \
-	static ::godot::StringName &get_class_static() {                                                               \
-		static ::godot::StringName string_name = ::godot::StringName(#m_class);                                    \
-		return string_name;                                                                                        \
+	static const ::godot::StringName &get_class_static() {                                                         \
+		return SNAME(#m_class);                                                                                    \
 	}                                                                                                              \
                                                                                                                    \
-	static ::godot::StringName &get_parent_class_static() {                                                        \
+	static const ::godot::StringName &get_parent_class_static() {                                                  \
 		return m_inherits::get_class_static();                                                                     \
 	}                                                                                                              \
                                                                                                                    \
 	static void *___binding_create_callback(void *p_token, void *p_instance) {                                     \
 		/* Do not call memnew here, we don't want the postinitializer to be called */                              \
+		::godot::internal::InstanceBindingCache::record_wrapper_allocation();                                      \
 		return new ("") m_class((GodotObject *)p_instance);                                                        \
 	}                                                                                                              \
 	static void ___binding_free_callback(void *p_token, void *p_instance, void *p_binding) {                       \
+		::godot::internal::InstanceBindingCache::invalidate(p_instance);                                           \
 		/* Explicitly call the deconstructor to ensure proper lifecycle for non-trivial members */                 \
 		reinterpret_cast<m_class *>(p_binding)->~m_class();                                                        \
 		Memory::free_static(reinterpret_cast<m_class *>(p_binding));                                               \
@@ -33,42 +33,57 @@
 
 #include <godot/gdnative_interface.h>
 
+#include <godot_cpp/core/defs.hpp>
+
 #include <array>
+#include <type_traits>
 
 namespace godot {
 
 namespace internal {
 
+// The engine assigns ptrcall return values into already valid storage. For the generated builtin types,
+// zeroed opaque data is enough for that, so skip their engine-side default constructor. Relies on
+// guaranteed copy elision, the value is created directly in the caller's `ret`.
+template <class T>
+_FORCE_INLINE_ T _make_ptrcall_ret() {
+	if constexpr (std::is_constructible_v<T, NoInitTag>) {
+		return T(NoInitTag());
+	} else {
+		return T();
+	}
+}
+
 template <class... Args>
-void _call_builtin_constructor(const GDNativePtrConstructor constructor, GDNativeTypePtr base, Args... args) {
+void _call_builtin_constructor(const GDNativePtrConstructor constructor, GDNativeTypePtr base, const Args &...args) {
 	std::array<GDNativeConstTypePtr, sizeof...(Args)> call_args = { { (GDNativeConstTypePtr)args... } };
 	constructor(base, call_args.data());
 }
 
 template <class T, class... Args>
-T _call_builtin_method_ptr_ret(const GDNativePtrBuiltInMethod method, GDNativeTypePtr base, Args... args) {
-	T ret;
+T _call_builtin_method_ptr_ret(const GDNativePtrBuiltInMethod method, GDNativeTypePtr base, const Args &...args) {
+	T ret = _make_ptrcall_ret<T>();
 	std::array<GDNativeConstTypePtr, sizeof...(Args)> call_args = { { (GDNativeConstTypePtr)args... } };
 	method(base, call_args.data(), &ret, sizeof...(Args));
 	return ret;
 }
 
 template <class... Args>
-void _call_builtin_method_ptr_no_ret(const GDNativePtrBuiltInMethod method, GDNativeTypePtr base, Args... args) {
+void _call_builtin_method_ptr_no_ret(const GDNativePtrBuiltInMethod method, GDNativeTypePtr base, const Args &...args) {
 	std::array<GDNativeConstTypePtr, sizeof...(Args)> call_args = { { (GDNativeConstTypePtr)args... } };
 	method(base, call_args.data(), nullptr, sizeof...(Args));
 }
 
 template <class T>
 T _call_builtin_operator_ptr(const GDNativePtrOperatorEvaluator op, GDNativeConstTypePtr left, GDNativeConstTypePtr right) {
-	T ret;
+	T ret = _make_ptrcall_ret<T>();
 	op(left, right, &ret);
 	return ret;
 }
 
 template <class T>
 T _call_builtin_ptr_getter(const GDNativePtrGetter getter, GDNativeConstTypePtr base) {
-	T ret;
+	T ret = _make_ptrcall_ret<T>();
 	getter(base, &ret);
 	return ret;
 }
@@ -35,13 +35,20 @@
 
 #include <godot_cpp/core/defs.hpp>
 #include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/instance_pool.hpp>
 #include <godot_cpp/core/method_bind.hpp>
+#include <godot_cpp/core/name_map.hpp>
+#include <godot_cpp/core/notification_dispatch.hpp>
 #include <godot_cpp/core/object.hpp>
+#include <godot_cpp/core/property_accessor.hpp>
 
+#include <array>
 #include <list>
 #include <set>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 // Needed to use StringName as key in `std::unordered_map`
@@ -56,23 +63,49 @@ namespace godot {
 
 #define DEFVAL(m_defval) (m_defval)
 
+// The number of argument names is part of the type, so bind_method() can check it against the method at compile time.
+template <size_t N>
 struct MethodDefinition {
 	StringName name;
-	std::list<StringName> args;
-	MethodDefinition() {}
-	MethodDefinition(StringName p_name) :
-			name(p_name) {}
+	std::array<StringName, N> args;
 };
 
-MethodDefinition D_METHOD(StringName p_name);
-MethodDefinition D_METHOD(StringName p_name, StringName p_arg1);
 template <typename... Args>
-MethodDefinition D_METHOD(StringName p_name, StringName p_arg1, Args... args) {
-	MethodDefinition md = D_METHOD(p_name, args...);
-	md.args.push_front(p_arg1);
-	return md;
+MethodDefinition<sizeof...(Args)> D_METHOD(StringName p_name, const Args &...p_args) {
+	return MethodDefinition<sizeof...(Args)>{ p_name, { { StringName(p_args)... } } };
 }
 
+namespace internal {
+
+template <class M>
+struct MethodArgumentCount;
+
+template <class T, class R, class... P>
+struct MethodArgumentCount<R (T::*)(P...)> {
+	static constexpr size_t value = sizeof...(P);
+};
+
+template <class T, class R, class... P>
+struct MethodArgumentCount<R (T::*)(P...) const> {
+	static constexpr size_t value = sizeof...(P);
+};
+
+template <class R, class... P>
+struct MethodArgumentCount<R (*)(P...)> {
+	static constexpr size_t value = sizeof...(P);
+};
+
+template <size_t N>
+_FORCE_INLINE_ const MethodDefinition<N> &_make_method_definition(const MethodDefinition<N> &p_definition) {
+	return p_definition;
+}
+
+_FORCE_INLINE_ MethodDefinition<0> _make_method_definition(const StringName &p_name) {
+	return MethodDefinition<0>{ p_name, {} };
+}
+
+} // namespace internal
+
 class ClassDB {
 	static GDNativeInitializationLevel current_level;
 
@@ -88,25 +121,51 @@ public:
 		Variant::Type type;
 	};
 
+	// Own and inherited virtual methods of a class, flattened when its registration completes. Open addressed
+	// and keyed by the interned name data (like PropertyAccessorMap), so a lookup is usually a single probe.
+	class VirtualTable {
+		struct Slot {
+			const void *name = nullptr;
+			GDNativeExtensionClassCallVirtual call = nullptr;
+		};
+
+		std::vector<Slot> slots;
+		uint32_t mask = 0;
+
+		void _insert(const void *p_name, GDNativeExtensionClassCallVirtual p_call);
+
+	public:
+		void build(const NameMap<GDNativeExtensionClassCallVirtual> &p_own, const VirtualTable *p_inherited);
+		GDNativeExtensionClassCallVirtual find(const StringName &p_name) const;
+	};
+
 	struct ClassInfo {
 		StringName name;
 		StringName parent_name;
 		GDNativeInitializationLevel level = GDNATIVE_INITIALIZATION_SCENE;
-		std::unordered_map<StringName, MethodBind *> method_map;
-		std::set<StringName> signal_names;
-		std::unordered_map<StringName, GDNativeExtensionClassCallVirtual> virtual_methods;
-		std::set<StringName> property_names;
-		std::set<StringName> constant_names;
+		NameMap<MethodBind *> method_map;
+		NameSet signal_names;
+		NameMap<GDNativeExtensionClassCallVirtual> virtual_methods;
+		VirtualTable virtual_table;
+		NameSet property_names;
+		NameSet constant_names;
+		PropertyAccessorMap property_accessors;
+		NotificationDispatch notification_dispatch;
 		// Pointer to the parent custom class, if any. Will be null if the parent class is a Godot class.
 		ClassInfo *parent_ptr = nullptr;
+		// The class's own pool if it was registered with register_pooled_class(), released on deinitialize.
+		InstancePool *instance_pool = nullptr;
+		// Wall time spent registering the class, from its creation in the engine to the submission of its members.
+		uint64_t registration_usec = 0;
 	};
 
 private:
 	// This may only contain custom classes, not Godot classes
-	static std::unordered_map<StringName, ClassInfo> classes;
+	static NameMap<ClassInfo> classes;
 
-	static MethodBind *bind_methodfi(uint32_t p_flags, MethodBind *p_bind, const MethodDefinition &method_name, const void **p_defs, int p_defcount);
-	static void initialize_class(const ClassInfo &cl);
+	static MethodBind *bind_methodfi(uint32_t p_flags, MethodBind *p_bind, const StringName &p_name, const StringName *p_arg_names, int p_arg_count, const void **p_defs, int p_defcount);
+	static void _begin_registration(const StringName &p_class);
+	static void initialize_class(ClassInfo &cl);
 	static void bind_method_godot(const StringName &p_class_name, MethodBind *p_method);
 
 	template <class T, bool is_abstract>
@@ -117,6 +176,8 @@ public:
 	static void register_class(bool p_virtual = false);
 	template <class T>
 	static void register_abstract_class();
+	template <class T>
+	static void register_pooled_class(uint32_t p_initial_slab_capacity = 64);
 
 	template <class N, class M, typename... VarArgs>
 	static MethodBind *bind_method(N p_method_name, M p_method, VarArgs... p_args);
@@ -133,8 +194,14 @@ public:
 	static void add_signal(const StringName &p_class, const MethodInfo &p_signal);
 	static void bind_integer_constant(const StringName &p_class_name, const StringName &p_enum_name, const StringName &p_constant_name, GDNativeInt p_constant_value, bool p_is_bitfield = false);
 	static void bind_virtual_method(const StringName &p_class, const StringName &p_method, GDNativeExtensionClassCallVirtual p_call);
+	// Only the listed notifications reach the class's _notification(), others are dropped before calling it.
+	static void set_notification_filter(const StringName &p_class, const std::vector<int32_t> &p_notifications);
+	template <class T, auto m_member>
+	static void bind_property_accessor(const StringName &p_name);
 
 	static MethodBind *get_method(const StringName &p_class, const StringName &p_method);
+	static const InstancePool *get_instance_pool(const StringName &p_class);
+	static uint64_t get_registration_time_usec(const StringName &p_class);
 
 	static GDNativeExtensionClassCallVirtual get_virtual_func(void *p_userdata, GDNativeConstStringNamePtr p_name);
 
@@ -151,6 +218,9 @@ public:
 #define BIND_BITFIELD_FLAG(m_constant) \
 	godot::ClassDB::bind_integer_constant(get_class_static(), godot::__constant_get_bitfield_name(m_constant, #m_constant), #m_constant, m_constant, true);
 
+#define BIND_PROPERTY_ACCESSOR(m_name, m_member) \
+	godot::ClassDB::bind_property_accessor<self_type, &self_type::m_member>(m_name);
+
 #define BIND_VIRTUAL_METHOD(m_class, m_method)                                                                                   \
 	{                                                                                                                            \
 		auto ___call##m_method = [](GDNativeObjectPtr p_instance, GDNativeConstTypePtr *p_args, GDNativeTypePtr p_ret) -> void { \
@@ -163,15 +233,33 @@ template <class T, bool is_abstract>
 void ClassDB::_register_class(bool p_virtual) {
 	// Register this class within our plugin
 	ClassInfo cl;
-	cl.name = T::get_class_static();
+	cl.name = StringName(T::___class_name_str);
 	cl.parent_name = T::get_parent_class_static();
 	cl.level = current_level;
-	std::unordered_map<StringName, ClassInfo>::iterator parent_it = classes.find(cl.parent_name);
-	if (parent_it != classes.end()) {
+	ClassInfo *parent = classes.getptr(cl.parent_name);
+	if (parent) {
 		// Assign parent if it is also a custom class
-		cl.parent_ptr = &parent_it->second;
+		cl.parent_ptr = parent;
+		// Properties bound by the parent stay reachable when this class overrides _set()/_get().
+		cl.property_accessors = parent->property_accessors;
+		// So does the parent's _notification(), with its filter, unless this class declares its own.
+		cl.notification_dispatch = parent->notification_dispatch;
 	}
-	classes[cl.name] = cl;
+	if constexpr (T::___has_own_notification()) {
+		cl.notification_dispatch = NotificationDispatch();
+		cl.notification_dispatch.handler = &T::___notification_call;
+	}
+	ClassInfo &info = classes.insert(cl.name, cl);
+
+	// The registry owns the interned class name, get_class_static() only reads it from now on.
+	// NameMap never relocates its entries, so the pointer stays valid. The same goes for the
+	// ClassInfo itself, which is handed to Godot as class_userdata for get_virtual_func().
+	T::___class_name = &info.name;
+	T::___property_accessors = &info.property_accessors;
+	T::___notification_dispatch = &info.notification_dispatch;
+
+	// Members bound from here on are submitted to Godot together by initialize_class().
+	_begin_registration(cl.name);
 
 	// Register this class with Godot
 	GDNativeExtensionClassCreationInfo class_info = {
@@ -191,7 +279,7 @@ void ClassDB::_register_class(bool p_virtual) {
 		T::free, // GDNativeExtensionClassFreeInstance free_instance_func; /* this one is mandatory */
 		&ClassDB::get_virtual_func, // GDNativeExtensionClassGetVirtual get_virtual_func;
 		nullptr, // GDNativeExtensionClassGetRID get_rid;
-		(void *)&T::get_class_static(), // void *class_userdata;
+		(void *)&info, // void *class_userdata;
 	};
 
 	internal::gdn_interface->classdb_register_extension_class(internal::library, cl.name._native_ptr(), cl.parent_name._native_ptr(), &class_info);
@@ -200,7 +288,7 @@ void ClassDB::_register_class(bool p_virtual) {
 	T::initialize_class();
 
 	// now register our class within ClassDB within Godot
-	initialize_class(classes[cl.name]);
+	initialize_class(info);
 }
 
 template <class T>
@@ -213,19 +301,32 @@ void ClassDB::register_abstract_class() {
 	ClassDB::_register_class<T, true>();
 }
 
+template <class T>
+void ClassDB::register_pooled_class(uint32_t p_initial_slab_capacity) {
+	T::___instance_pool.setup(sizeof(T), alignof(T), p_initial_slab_capacity);
+	ClassDB::_register_class<T, false>();
+	classes[T::get_class_static()].instance_pool = &T::___instance_pool;
+}
+
 template <class N, class M, typename... VarArgs>
 MethodBind *ClassDB::bind_method(N p_method_name, M p_method, VarArgs... p_args) {
+	const auto &definition = internal::_make_method_definition(p_method_name);
+	static_assert(std::tuple_size<decltype(definition.args)>::value <= internal::MethodArgumentCount<M>::value, "Method definition has more argument names than the method has arguments.");
+	static_assert(sizeof...(p_args) <= internal::MethodArgumentCount<M>::value, "Method has more default values than arguments.");
 	Variant args[sizeof...(p_args) + 1] = { p_args..., Variant() }; // +1 makes sure zero sized arrays are also supported.
 	const Variant *argptrs[sizeof...(p_args) + 1];
 	for (uint32_t i = 0; i < sizeof...(p_args); i++) {
 		argptrs[i] = &args[i];
 	}
 	MethodBind *bind = create_method_bind(p_method);
-	return bind_methodfi(METHOD_FLAGS_DEFAULT, bind, p_method_name, sizeof...(p_args) == 0 ? nullptr : (const void **)argptrs, sizeof...(p_args));
+	return bind_methodfi(METHOD_FLAGS_DEFAULT, bind, definition.name, definition.args.data(), (int)definition.args.size(), sizeof...(p_args) == 0 ? nullptr : (const void **)argptrs, sizeof...(p_args));
 }
 
 template <class N, class M, typename... VarArgs>
 MethodBind *ClassDB::bind_static_method(StringName p_class, N p_method_name, M p_method, VarArgs... p_args) {
+	const auto &definition = internal::_make_method_definition(p_method_name);
+	static_assert(std::tuple_size<decltype(definition.args)>::value <= internal::MethodArgumentCount<M>::value, "Method definition has more argument names than the method has arguments.");
+	static_assert(sizeof...(p_args) <= internal::MethodArgumentCount<M>::value, "Method has more default values than arguments.");
 	Variant args[sizeof...(p_args) + 1] = { p_args..., Variant() }; // +1 makes sure zero sized arrays are also supported.
 	const Variant *argptrs[sizeof...(p_args) + 1];
 	for (uint32_t i = 0; i < sizeof...(p_args); i++) {
@@ -233,7 +334,7 @@ MethodBind *ClassDB::bind_static_method(StringName p_class, N p_method_name, M p
 	}
 	MethodBind *bind = create_static_method_bind(p_method);
 	bind->set_instance_class(p_class);
-	return bind_methodfi(0, bind, p_method_name, sizeof...(p_args) == 0 ? nullptr : (const void **)argptrs, sizeof...(p_args));
+	return bind_methodfi(0, bind, definition.name, definition.args.data(), (int)definition.args.size(), sizeof...(p_args) == 0 ? nullptr : (const void **)argptrs, sizeof...(p_args));
 }
 
 template <class M>
@@ -246,15 +347,15 @@ MethodBind *ClassDB::bind_vararg_method(uint32_t p_flags, StringName p_name, M p
 
 	StringName instance_type = bind->get_instance_class();
 
-	std::unordered_map<StringName, ClassInfo>::iterator type_it = classes.find(instance_type);
-	if (type_it == classes.end()) {
+	ClassInfo *type_ptr = classes.getptr(instance_type);
+	if (!type_ptr) {
 		memdelete(bind);
 		ERR_FAIL_V_MSG(nullptr, String("Class '{0}' doesn't exist.").format(Array::make(instance_type)));
 	}
 
-	ClassInfo &type = type_it->second;
+	ClassInfo &type = *type_ptr;
 
-	if (type.method_map.find(p_name) != type.method_map.end()) {
+	if (type.method_map.has(p_name)) {
 		memdelete(bind);
 		ERR_FAIL_V_MSG(nullptr, String("Binding duplicate method: {0}::{1}.").format(Array::make(instance_type, p_method)));
 	}
@@ -268,6 +369,25 @@ MethodBind *ClassDB::bind_vararg_method(uint32_t p_flags, StringName p_name, M p
 	return bind;
 }
 
+template <class T, auto m_member>
+void ClassDB::bind_property_accessor(const StringName &p_name) {
+	typedef std::remove_cv_t<std::remove_reference_t<decltype(std::declval<T &>().*m_member)>> V;
+
+	ClassInfo *type_ptr = classes.getptr(T::get_class_static());
+	ERR_FAIL_COND_MSG(!type_ptr, String("Trying to add property accessor '{0}' to non-existing class '{1}'.").format(Array::make(p_name, T::get_class_static())));
+
+	PropertyAccessor accessor;
+	accessor.set = [](GDExtensionClassInstancePtr p_instance, const Variant &p_value) -> bool {
+		reinterpret_cast<T *>(p_instance)->*m_member = VariantCaster<V>::cast(p_value);
+		return true;
+	};
+	accessor.get = [](GDExtensionClassInstancePtr p_instance, Variant &r_ret) -> bool {
+		r_ret = reinterpret_cast<const T *>(p_instance)->*m_member;
+		return true;
+	};
+	type_ptr->property_accessors[p_name] = accessor;
+}
+
 #define GDREGISTER_CLASS(m_class) ClassDB::register_class<m_class>();
 #define GDREGISTER_VIRTUAL_CLASS(m_class) ClassDB::register_class<m_class>(true);
 #define GDREGISTER_ABSTRACT_CLASS(m_class) ClassDB::register_abstract_class<m_class>();
@@ -127,4 +127,14 @@ struct BuildIndexSequence : BuildIndexSequence<N - 1, N - 1, Is...> {};
 template <size_t... Is>
 struct BuildIndexSequence<0, Is...> : IndexSequence<Is...> {};
 
+namespace godot {
+namespace internal {
+
+// Selects the constructor of generated builtin types that leaves the opaque data zeroed (the empty value
+// on the engine side) instead of calling the engine's default constructor. Only for ptrcall return values.
+struct NoInitTag {};
+
+} // namespace internal
+} // namespace godot
+
 #endif // GODOT_DEFS_HPP
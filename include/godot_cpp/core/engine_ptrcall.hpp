@@ -34,6 +34,8 @@
 #include <godot/gdnative_interface.h>
 
 #include <godot_cpp/core/binder_common.hpp>
+#include <godot_cpp/core/builtin_ptrcall.hpp>
+#include <godot_cpp/core/instance_binding_cache.hpp>
 #include <godot_cpp/core/object.hpp>
 #include <godot_cpp/godot.hpp>
 
@@ -51,12 +53,12 @@ O *_call_native_mb_ret_obj(const GDNativeMethodBindPtr mb, void *instance, const
 	if (ret == nullptr) {
 		return nullptr;
 	}
-	return reinterpret_cast<O *>(internal::gdn_interface->object_get_instance_binding(ret, internal::token, &O::___binding_callbacks));
+	return reinterpret_cast<O *>(InstanceBindingCache::get(ret, &O::___binding_callbacks));
 }
 
 template <class R, class... Args>
 R _call_native_mb_ret(const GDNativeMethodBindPtr mb, void *instance, const Args &...args) {
-	R ret;
+	R ret = _make_ptrcall_ret<R>();
 	std::array<GDNativeConstTypePtr, sizeof...(Args)> mb_args = { { (GDNativeConstTypePtr)args... } };
 	internal::gdn_interface->object_method_bind_ptrcall(mb, instance, mb_args.data(), &ret);
 	return ret;
@@ -70,7 +72,7 @@ void _call_native_mb_no_ret(const GDNativeMethodBindPtr mb, void *instance, cons
 
 template <class R, class... Args>
 R _call_utility_ret(GDNativePtrUtilityFunction func, const Args &...args) {
-	R ret;
+	R ret = _make_ptrcall_ret<R>();
 	std::array<GDNativeConstTypePtr, sizeof...(Args)> mb_args = { { (GDNativeConstTypePtr)args... } };
 	func(&ret, mb_args.data(), mb_args.size());
 	return ret;
@@ -81,7 +83,7 @@ Object *_call_utility_ret_obj(const GDNativePtrUtilityFunction func, void *insta
 	GodotObject *ret = nullptr;
 	std::array<GDNativeConstTypePtr, sizeof...(Args)> mb_args = { { (GDNativeConstTypePtr)args... } };
 	func(&ret, mb_args.data(), mb_args.size());
-	return (Object *)internal::gdn_interface->object_get_instance_binding(ret, internal::token, &Object::___binding_callbacks);
+	return (Object *)InstanceBindingCache::get(ret, &Object::___binding_callbacks);
 }
 
 template <class... Args>
@@ -0,0 +1,137 @@
+/*************************************************************************/
+/*  instance_binding_cache.hpp                                           */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef GODOT_INSTANCE_BINDING_CACHE_HPP
+#define GODOT_INSTANCE_BINDING_CACHE_HPP
+
+#include <godot_cpp/core/defs.hpp>
+
+#include <godot_cpp/godot.hpp>
+
+#include <godot/gdnative_interface.h>
+
+#include <atomic>
+#include <cstdint>
+
+namespace godot {
+
+namespace internal {
+
+// Per-thread cache in front of object_get_instance_binding(), which takes a lock in the engine.
+// Entries are direct mapped by object address and validated against a generation counter. The
+// generation of an object's bucket is bumped whenever one of our bindings or instances is freed,
+// so an entry never outlives the wrapper it points to, even if the address gets reused.
+class InstanceBindingCache {
+public:
+	static constexpr uint32_t CACHE_SIZE = 64;
+	static constexpr uint32_t GENERATION_BUCKETS = 256;
+
+	struct Stats {
+		uint64_t hits = 0;
+		uint64_t misses = 0;
+		uint64_t wrapper_allocations = 0;
+		uint64_t invalidations = 0;
+	};
+
+private:
+	struct Entry {
+		GDNativeObjectPtr object = nullptr;
+		void *binding = nullptr;
+		uint32_t generation = 0;
+	};
+
+	static thread_local Entry entries[CACHE_SIZE];
+	static std::atomic<uint32_t> generations[GENERATION_BUCKETS];
+
+#ifdef DEBUG_ENABLED
+	static std::atomic<uint64_t> hits;
+	static std::atomic<uint64_t> misses;
+	static std::atomic<uint64_t> wrapper_allocations;
+	static std::atomic<uint64_t> invalidations;
+#endif
+
+	static _FORCE_INLINE_ uint32_t _hash(const void *p_object) {
+		uint64_t v = uint64_t(uintptr_t(p_object)) >> 4;
+		v *= 0x9E3779B97F4A7C15ull;
+		return uint32_t(v >> 32);
+	}
+
+public:
+	static _FORCE_INLINE_ void *get(GDNativeObjectPtr p_object, const GDNativeInstanceBindingCallbacks *p_callbacks) {
+		if (unlikely(p_object == nullptr)) {
+			return nullptr;
+		}
+		const uint32_t h = _hash(p_object);
+		Entry &entry = entries[h & (CACHE_SIZE - 1)];
+		// Read the generation before asking the engine, so a free racing with the lookup leaves a stale entry behind.
+		const uint32_t generation = generations[(h >> 8) & (GENERATION_BUCKETS - 1)].load(std::memory_order_acquire);
+		if (entry.object == p_object && entry.generation == generation) {
+#ifdef DEBUG_ENABLED
+			hits.fetch_add(1, std::memory_order_relaxed);
+#endif
+			return entry.binding;
+		}
+#ifdef DEBUG_ENABLED
+		misses.fetch_add(1, std::memory_order_relaxed);
+#endif
+		void *binding = gdn_interface->object_get_instance_binding(p_object, token, p_callbacks);
+		if (binding != nullptr) {
+			entry.object = p_object;
+			entry.binding = binding;
+			entry.generation = generation;
+		}
+		return binding;
+	}
+
+	static _FORCE_INLINE_ void invalidate(const void *p_object) {
+		generations[(_hash(p_object) >> 8) & (GENERATION_BUCKETS - 1)].fetch_add(1, std::memory_order_release);
+#ifdef DEBUG_ENABLED
+		invalidations.fetch_add(1, std::memory_order_relaxed);
+#endif
+	}
+
+	static _FORCE_INLINE_ void record_wrapper_allocation() {
+#ifdef DEBUG_ENABLED
+		wrapper_allocations.fetch_add(1, std::memory_order_relaxed);
+#endif
+	}
+
+	static void clear(); // Invalidates the entries of every thread.
+
+	// Counters are only maintained in builds with DEBUG_ENABLED, otherwise they stay at zero.
+	static Stats get_stats();
+	static void reset_stats();
+};
+
+} // namespace internal
+
+} // namespace godot
+
+#endif // GODOT_INSTANCE_BINDING_CACHE_HPP
@@ -0,0 +1,96 @@
+/*************************************************************************/
+/*  instance_pool.hpp                                                    */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef GODOT_INSTANCE_POOL_HPP
+#define GODOT_INSTANCE_POOL_HPP
+
+#include <godot_cpp/core/defs.hpp>
+#include <godot_cpp/templates/spin_lock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace godot {
+
+// Slab allocator for the instances of one extension class, enabled with ClassDB::register_pooled_class().
+// Instances live next to each other in slabs and freed slots are reused before new ones are carved out.
+// Slabs double in size as the pool grows, so there are few of them and owns() stays cheap; it is needed
+// because instances made with memnew() in C++ still come from the regular allocator.
+//
+// reset() stops allocations. If instances are still alive at that point, the slabs are kept (so free() still
+// recognizes them) and released when the last one is freed.
+class InstancePool {
+	struct Slab {
+		uint8_t *memory = nullptr;
+		uint32_t capacity = 0;
+	};
+
+	std::vector<Slab> slabs;
+	void *free_list = nullptr;
+	uint32_t element_size = 0;
+	uint32_t next_slab_capacity = 0;
+	uint32_t slab_used = 0; // Slots carved out of the last slab so far.
+
+	uint32_t used_count = 0;
+	uint32_t capacity = 0;
+	uint32_t peak_used_count = 0;
+	uint64_t total_allocations = 0;
+
+	// Read without the lock on every create() and free() of the class.
+	std::atomic<bool> enabled = false; // New instances come from the pool.
+	std::atomic<bool> has_slabs = false; // Instances may have to be returned to the pool.
+
+	mutable SpinLock spin_lock;
+
+	bool _owns(const void *p_ptr) const;
+	void _release_slabs();
+
+public:
+	_FORCE_INLINE_ bool is_enabled() const { return enabled.load(std::memory_order_relaxed); }
+	_FORCE_INLINE_ bool may_own_instances() const { return has_slabs.load(std::memory_order_relaxed); }
+
+	void setup(size_t p_element_size, size_t p_alignment, uint32_t p_initial_slab_capacity);
+	void *alloc();
+	bool free(void *p_ptr); // Returns false if the memory doesn't come from this pool.
+	bool owns(const void *p_ptr) const;
+	void reset(); // Stops allocations, and releases the slabs once no instance is alive.
+
+	uint32_t get_used_count() const;
+	uint32_t get_capacity() const;
+	uint32_t get_peak_used_count() const;
+	uint32_t get_slab_count() const;
+	uint64_t get_total_allocations() const;
+};
+
+} // namespace godot
+
+#endif // GODOT_INSTANCE_POOL_HPP
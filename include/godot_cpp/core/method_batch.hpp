@@ -0,0 +1,248 @@
+/*************************************************************************/
+/*  method_batch.hpp                                                     */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef GODOT_METHOD_BATCH_HPP
+#define GODOT_METHOD_BATCH_HPP
+
+#include <godot/gdnative_interface.h>
+
+#include <godot_cpp/core/builtin_ptrcall.hpp>
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/instance_binding_cache.hpp>
+#include <godot_cpp/core/math.hpp>
+#include <godot_cpp/core/method_ptrcall.hpp>
+#include <godot_cpp/core/object.hpp>
+#include <godot_cpp/godot.hpp>
+#include <godot_cpp/templates/thread_work_pool.hpp>
+
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace godot {
+
+template <class T>
+class Ref;
+
+namespace internal {
+
+// Objects, whether passed as wrapper pointers or as Refs, cross the engine boundary as their engine pointer.
+template <class A>
+struct MethodBatchObject : std::false_type {};
+
+template <class T>
+struct MethodBatchObject<T *> : std::is_base_of<Object, std::remove_const_t<T>> {
+	typedef std::remove_const_t<T> WrapperT;
+
+	static _FORCE_INLINE_ GodotObject *get_owner(T *p_value) { return p_value ? p_value->_owner : nullptr; }
+	static _FORCE_INLINE_ T *from_owner(GodotObject *p_owner) {
+		return p_owner ? reinterpret_cast<T *>(InstanceBindingCache::get(p_owner, &WrapperT::___binding_callbacks)) : nullptr;
+	}
+};
+
+template <class T>
+struct MethodBatchObject<Ref<T>> : std::true_type {
+	static _FORCE_INLINE_ GodotObject *get_owner(const Ref<T> &p_value) { return p_value.is_valid() ? p_value->_owner : nullptr; }
+	// Like the generated wrappers, takes over the reference the engine added for the returned value.
+	static _FORCE_INLINE_ Ref<T> from_owner(GodotObject *p_owner) {
+		return p_owner ? Ref<T>::___internal_constructor(reinterpret_cast<T *>(InstanceBindingCache::get(p_owner, &T::___binding_callbacks))) : Ref<T>();
+	}
+};
+
+} // namespace internal
+
+// Calls one engine method on many objects. The method bind is looked up once and the argument pointers are
+// set up once per batch (or once per object for call_each()), then the ptrcalls are issued back to back.
+// The hash is the one listed for the method in extension_api.json, the same the generated wrappers use.
+//
+// Objects are not type checked, they must all be instances of the class the method was looked up on.
+//
+// MAKE_METHOD_BATCH(CanvasItem, set_visible) takes the hash from the generated CanvasItem::MethodHash.
+#define MAKE_METHOD_BATCH(m_class, m_method) ::godot::MethodBatch(m_class::get_class_static(), #m_method, m_class::MethodHash::m_method)
+
+class MethodBatch {
+	GDNativeMethodBindPtr method_bind = nullptr;
+
+	template <class A>
+	static constexpr bool _is_object = internal::MethodBatchObject<A>::value;
+
+	// Arguments whose encoded form is the value itself can be passed straight from the caller's array.
+	// Objects never are, the engine expects their owner and not the wrapper or the Ref holding it.
+	template <class A>
+	static constexpr bool _is_passthrough = !_is_object<A> && !std::is_pointer_v<A> && std::is_same_v<typename PtrToArg<A>::EncodeT, A>;
+
+	// What an argument is encoded into. Objects are passed as the engine pointer itself, the same as the
+	// generated wrappers do, so their slot holds that pointer and is not pointed to.
+	template <class A>
+	using _Slot = std::conditional_t<_is_object<A>, GodotObject *, typename PtrToArg<A>::EncodeT>;
+
+	template <class A>
+	static _FORCE_INLINE_ GDNativeConstTypePtr _encode_arg(const A &p_value, _Slot<A> &r_slot) {
+		if constexpr (_is_object<A>) {
+			r_slot = internal::MethodBatchObject<A>::get_owner(p_value);
+			return r_slot;
+		} else if constexpr (_is_passthrough<A>) {
+			return &p_value;
+		} else {
+			PtrToArg<A>::encode(p_value, &r_slot);
+			return &r_slot;
+		}
+	}
+
+	template <class A>
+	static void _call_each_range(GDNativeMethodBindPtr p_method_bind, Object *const *p_objects, const A *p_values, uint32_t p_from, uint32_t p_to) {
+		_Slot<A> slot;
+		for (uint32_t i = p_from; i < p_to; i++) {
+			ERR_CONTINUE(p_objects[i] == nullptr);
+			GDNativeConstTypePtr arg = _encode_arg(p_values[i], slot);
+			internal::gdn_interface->object_method_bind_ptrcall(p_method_bind, p_objects[i]->_owner, &arg, nullptr);
+		}
+	}
+
+	template <class R>
+	static void _call_ret_range(GDNativeMethodBindPtr p_method_bind, Object *const *p_objects, R *r_results, uint32_t p_from, uint32_t p_to) {
+		if constexpr (_is_object<R>) {
+			for (uint32_t i = p_from; i < p_to; i++) {
+				ERR_CONTINUE(p_objects[i] == nullptr);
+				// Cleared for every call, the engine assigns returned Refs over what the slot holds.
+				GodotObject *ret = nullptr;
+				internal::gdn_interface->object_method_bind_ptrcall(p_method_bind, p_objects[i]->_owner, nullptr, &ret);
+				r_results[i] = internal::MethodBatchObject<R>::from_owner(ret);
+			}
+			return;
+		}
+		typename PtrToArg<R>::EncodeT encoded = internal::_make_ptrcall_ret<typename PtrToArg<R>::EncodeT>();
+		for (uint32_t i = p_from; i < p_to; i++) {
+			ERR_CONTINUE(p_objects[i] == nullptr);
+			if constexpr (_is_passthrough<R>) {
+				internal::gdn_interface->object_method_bind_ptrcall(p_method_bind, p_objects[i]->_owner, nullptr, &r_results[i]);
+			} else {
+				internal::gdn_interface->object_method_bind_ptrcall(p_method_bind, p_objects[i]->_owner, nullptr, &encoded);
+				r_results[i] = static_cast<R>(encoded);
+			}
+		}
+	}
+
+	template <class A>
+	struct EachWork {
+		GDNativeMethodBindPtr method_bind;
+		Object *const *objects;
+		const A *values;
+		uint32_t count;
+		uint32_t chunk_size;
+
+		void work(uint32_t p_chunk, void *) {
+			uint32_t from = p_chunk * chunk_size;
+			_call_each_range(method_bind, objects, values, from, Math::min(from + chunk_size, count));
+		}
+	};
+
+	template <class R>
+	struct RetWork {
+		GDNativeMethodBindPtr method_bind;
+		Object *const *objects;
+		R *results;
+		uint32_t count;
+		uint32_t chunk_size;
+
+		void work(uint32_t p_chunk, void *) {
+			uint32_t from = p_chunk * chunk_size;
+			_call_ret_range(method_bind, objects, results, from, Math::min(from + chunk_size, count));
+		}
+	};
+
+	// Hand out work in chunks, so the pool's shared counter is not hit once per call.
+	_FORCE_INLINE_ static uint32_t _get_chunk_size(uint32_t p_count, const ThreadWorkPool &p_pool) {
+		const uint32_t min_chunk_size = 64;
+		uint32_t chunks = MAX(p_pool.get_thread_count(), 1) * 4;
+		return MAX((p_count + chunks - 1) / chunks, min_chunk_size);
+	}
+
+	template <class Tuple, class... Args, size_t... Is>
+	static void _encode_args(Tuple &r_encoded, std::array<GDNativeConstTypePtr, sizeof...(Args)> &r_args, std::index_sequence<Is...>, const Args &...p_args) {
+		((r_args[Is] = _encode_arg(p_args, std::get<Is>(r_encoded))), ...);
+	}
+
+public:
+	_FORCE_INLINE_ bool is_valid() const { return method_bind != nullptr; }
+
+	// Calls the method on every object with the same arguments, encoded only once.
+	template <class... Args>
+	void call(Object *const *p_objects, uint32_t p_count, const Args &...p_args) const {
+		ERR_FAIL_COND_MSG(!is_valid(), "Method bind not found.");
+		std::tuple<_Slot<Args>...> encoded;
+		std::array<GDNativeConstTypePtr, sizeof...(Args)> args;
+		_encode_args(encoded, args, std::index_sequence_for<Args...>(), p_args...);
+		for (uint32_t i = 0; i < p_count; i++) {
+			ERR_CONTINUE(p_objects[i] == nullptr);
+			internal::gdn_interface->object_method_bind_ptrcall(method_bind, p_objects[i]->_owner, args.data(), nullptr);
+		}
+	}
+
+	// Calls a single argument method on every object, with p_values[i] passed to p_objects[i].
+	template <class A>
+	void call_each(Object *const *p_objects, const A *p_values, uint32_t p_count) const {
+		ERR_FAIL_COND_MSG(!is_valid(), "Method bind not found.");
+		_call_each_range(method_bind, p_objects, p_values, 0, p_count);
+	}
+
+	// Calls a method taking no arguments on every object, storing what p_objects[i] returned in r_results[i].
+	template <class R>
+	void call_ret(Object *const *p_objects, R *r_results, uint32_t p_count) const {
+		ERR_FAIL_COND_MSG(!is_valid(), "Method bind not found.");
+		_call_ret_range(method_bind, p_objects, r_results, 0, p_count);
+	}
+
+	// Threaded versions of the above. Only use them for methods the engine documents as thread-safe, on
+	// objects no other thread is using; the pool must already be initialized.
+	template <class A>
+	void call_each_threaded(ThreadWorkPool &p_pool, Object *const *p_objects, const A *p_values, uint32_t p_count) const {
+		ERR_FAIL_COND_MSG(!is_valid(), "Method bind not found.");
+		EachWork<A> w = { method_bind, p_objects, p_values, p_count, _get_chunk_size(p_count, p_pool) };
+		p_pool.do_work((p_count + w.chunk_size - 1) / w.chunk_size, &w, &EachWork<A>::work, (void *)nullptr);
+	}
+
+	template <class R>
+	void call_ret_threaded(ThreadWorkPool &p_pool, Object *const *p_objects, R *r_results, uint32_t p_count) const {
+		ERR_FAIL_COND_MSG(!is_valid(), "Method bind not found.");
+		RetWork<R> w = { method_bind, p_objects, r_results, p_count, _get_chunk_size(p_count, p_pool) };
+		p_pool.do_work((p_count + w.chunk_size - 1) / w.chunk_size, &w, &RetWork<R>::work, (void *)nullptr);
+	}
+
+	MethodBatch() {}
+	MethodBatch(const StringName &p_class, const StringName &p_method, GDNativeInt p_hash) {
+		method_bind = internal::gdn_interface->classdb_get_method_bind(p_class._native_ptr(), p_method._native_ptr(), p_hash);
+	}
+};
+
+} // namespace godot
+
+#endif // GODOT_METHOD_BATCH_HPP
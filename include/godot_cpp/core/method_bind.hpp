@@ -41,6 +41,7 @@
 #include <godot_cpp/classes/global_constants.hpp>
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <iostream>
@@ -105,9 +106,9 @@ public:
 	_FORCE_INLINE_ bool has_return() const { return _has_return; }
 	_FORCE_INLINE_ uint32_t get_hint_flags() const { return hint_flags | (is_const() ? GDNATIVE_EXTENSION_METHOD_FLAG_CONST : 0) | (is_vararg() ? GDNATIVE_EXTENSION_METHOD_FLAG_VARARG : 0) | (is_static() ? GDNATIVE_EXTENSION_METHOD_FLAG_STATIC : 0); }
 	_FORCE_INLINE_ void set_hint_flags(uint32_t p_hint_flags) { hint_flags = p_hint_flags; }
-	void set_argument_names(const std::vector<StringName> &p_names);
+	void set_argument_names(std::vector<StringName> p_names);
 	std::vector<StringName> get_argument_names() const;
-	void set_default_arguments(const std::vector<Variant> &p_default_arguments) { default_arguments = p_default_arguments; }
+	void set_default_arguments(std::vector<Variant> p_default_arguments) { default_arguments = std::move(p_default_arguments); }
 
 	_FORCE_INLINE_ GDNativeVariantType get_argument_type(int p_argument) const {
 		ERR_FAIL_COND_V(p_argument < -1 || p_argument > argument_count, GDNATIVE_VARIANT_TYPE_NIL);
@@ -0,0 +1,177 @@
+/*************************************************************************/
+/*  name_map.hpp                                                         */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef GODOT_NAME_MAP_HPP
+#define GODOT_NAME_MAP_HPP
+
+#include <godot_cpp/core/defs.hpp>
+#include <godot_cpp/variant/sname.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace godot {
+
+// Flat map keyed by the interned StringName data, for the ClassDB registries. Lookups probe an open addressed
+// index of { name data, entry } slots, so finding a name reads one slot and never calls into the engine.
+// Entries live in a deque and are only ever appended, so their addresses stay valid while the map grows.
+// There is no erase, registries only grow until the extension is unloaded.
+template <class V>
+class NameMap {
+public:
+	struct Entry {
+		StringName key;
+		V value;
+	};
+
+	typedef typename std::deque<Entry>::const_iterator ConstIterator;
+	typedef typename std::deque<Entry>::iterator Iterator;
+
+private:
+	static constexpr uint32_t MIN_CAPACITY = 8;
+
+	struct Slot {
+		const void *name = nullptr;
+		// Position in entries plus one, zero marks an empty slot (the empty name has null data too).
+		uint32_t entry = 0;
+	};
+
+	std::vector<Slot> slots;
+	std::deque<Entry> entries;
+	uint32_t mask = 0;
+
+	_FORCE_INLINE_ int64_t _find_entry(const void *p_name) const {
+		if (slots.empty()) {
+			return -1;
+		}
+		uint32_t i = internal::StringNameDataHasher::hash_data(p_name) & mask;
+		while (slots[i].entry != 0) {
+			if (slots[i].name == p_name) {
+				return slots[i].entry - 1;
+			}
+			i = (i + 1) & mask;
+		}
+		return -1;
+	}
+
+	void _place(const void *p_name, uint32_t p_entry) {
+		uint32_t i = internal::StringNameDataHasher::hash_data(p_name) & mask;
+		while (slots[i].entry != 0) {
+			i = (i + 1) & mask;
+		}
+		slots[i].name = p_name;
+		slots[i].entry = p_entry + 1;
+	}
+
+	void _rehash(uint32_t p_capacity) {
+		slots.assign(p_capacity, Slot());
+		mask = p_capacity - 1;
+		for (uint32_t i = 0; i < entries.size(); i++) {
+			_place(internal::_string_name_data(entries[i].key), i);
+		}
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t size() const { return (uint32_t)entries.size(); }
+	_FORCE_INLINE_ bool is_empty() const { return entries.empty(); }
+
+	_FORCE_INLINE_ bool has(const StringName &p_key) const {
+		return _find_entry(internal::_string_name_data(p_key)) >= 0;
+	}
+
+	_FORCE_INLINE_ V *getptr(const StringName &p_key) {
+		int64_t e = _find_entry(internal::_string_name_data(p_key));
+		return e >= 0 ? &entries[e].value : nullptr;
+	}
+
+	_FORCE_INLINE_ const V *getptr(const StringName &p_key) const {
+		int64_t e = _find_entry(internal::_string_name_data(p_key));
+		return e >= 0 ? &entries[e].value : nullptr;
+	}
+
+	V &insert(const StringName &p_key, const V &p_value) {
+		const void *name = internal::_string_name_data(p_key);
+		int64_t e = _find_entry(name);
+		if (e >= 0) {
+			entries[e].value = p_value;
+			return entries[e].value;
+		}
+		entries.push_back(Entry{ p_key, p_value });
+		// Keep the load factor at or below one half, so misses end quickly too.
+		if ((uint32_t)entries.size() * 2 > (uint32_t)slots.size()) {
+			_rehash(slots.empty() ? MIN_CAPACITY : (uint32_t)slots.size() * 2);
+		} else {
+			_place(name, (uint32_t)entries.size() - 1);
+		}
+		return entries.back().value;
+	}
+
+	V &operator[](const StringName &p_key) {
+		V *value = getptr(p_key);
+		if (value) {
+			return *value;
+		}
+		return insert(p_key, V());
+	}
+
+	void reserve(uint32_t p_count) {
+		uint32_t capacity = MIN_CAPACITY;
+		while (capacity < p_count * 2) {
+			capacity <<= 1;
+		}
+		if (capacity > (uint32_t)slots.size()) {
+			_rehash(capacity);
+		}
+	}
+
+	// Iteration follows insertion order.
+	_FORCE_INLINE_ Iterator begin() { return entries.begin(); }
+	_FORCE_INLINE_ Iterator end() { return entries.end(); }
+	_FORCE_INLINE_ ConstIterator begin() const { return entries.begin(); }
+	_FORCE_INLINE_ ConstIterator end() const { return entries.end(); }
+};
+
+// Set counterpart of NameMap, for the registries that only check for duplicates.
+class NameSet {
+	struct Empty {};
+
+	NameMap<Empty> map;
+
+public:
+	_FORCE_INLINE_ uint32_t size() const { return map.size(); }
+	_FORCE_INLINE_ bool has(const StringName &p_key) const { return map.has(p_key); }
+	_FORCE_INLINE_ void insert(const StringName &p_key) { map.insert(p_key, Empty()); }
+};
+
+} // namespace godot
+
+#endif // GODOT_NAME_MAP_HPP
@@ -0,0 +1,65 @@
+/*************************************************************************/
+/*  notification_dispatch.hpp                                            */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef GODOT_NOTIFICATION_DISPATCH_HPP
+#define GODOT_NOTIFICATION_DISPATCH_HPP
+
+#include <godot_cpp/core/defs.hpp>
+
+#include <godot/gdnative_interface.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace godot {
+
+// Notification handling of one extension class, resolved by ClassDB when the class is registered.
+// The handler calls the _notification() of the nearest class in the hierarchy that declares one, or
+// is null if none does. The filter is set with ClassDB::set_notification_filter(); it is sorted, and
+// while it is empty every notification goes through.
+struct NotificationDispatch {
+	GDNativeExtensionClassNotification handler = nullptr;
+	std::vector<int32_t> filter;
+
+	_FORCE_INLINE_ void dispatch(GDExtensionClassInstancePtr p_instance, int32_t p_what) const {
+		if (handler == nullptr) {
+			return;
+		}
+		if (!filter.empty() && !std::binary_search(filter.begin(), filter.end(), p_what)) {
+			return;
+		}
+		handler(p_instance, p_what);
+	}
+};
+
+} // namespace godot
+
+#endif // GODOT_NOTIFICATION_DISPATCH_HPP
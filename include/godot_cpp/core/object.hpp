@@ -33,6 +33,8 @@
 
 #include <godot_cpp/core/defs.hpp>
 
+#include <godot_cpp/core/instance_binding_cache.hpp>
+
 #include <godot_cpp/core/property_info.hpp>
 
 #include <godot_cpp/variant/variant.hpp>
@@ -43,6 +45,7 @@
 
 #include <godot/gdnative_interface.h>
 
+#include <atomic>
 #include <vector>
 
 #define ADD_SIGNAL(m_signal) godot::ClassDB::add_signal(get_class_static(), m_signal)
@@ -128,21 +131,46 @@ public:
 		if (obj == nullptr) {
 			return nullptr;
 		}
-		return reinterpret_cast<Object *>(internal::gdn_interface->object_get_instance_binding(obj, internal::token, &Object::___binding_callbacks));
+		return reinterpret_cast<Object *>(internal::InstanceBindingCache::get(obj, &Object::___binding_callbacks));
 	}
 };
 
+namespace internal {
+
+// Class tags don't change once a class is registered, so each cast_to<T>() looks its tag up only once.
+template <class T>
+void *_get_class_tag() {
+	static std::atomic<void *> tag = nullptr;
+	void *class_tag = tag.load(std::memory_order_relaxed);
+	if (unlikely(class_tag == nullptr)) {
+		class_tag = internal::gdn_interface->classdb_get_class_tag(T::get_class_static()._native_ptr());
+		tag.store(class_tag, std::memory_order_relaxed);
+	}
+	return class_tag;
+}
+
+} // namespace internal
+
+// True if p_object is an instance of the extension class T itself, not of a class derived from it. Unlike
+// cast_to(), this needs no engine call: extension instances are their own binding and know their class name.
+template <class T>
+bool Object::is_exact_class(const Object *p_object) {
+	return p_object != nullptr && p_object->_get_extension_class_name() == &T::get_class_static();
+}
+
 template <class T>
 T *Object::cast_to(Object *p_object) {
 	if (p_object == nullptr) {
 		return nullptr;
 	}
-	StringName class_name = T::get_class_static();
-	GDNativeObjectPtr casted = internal::gdn_interface->object_cast_to(p_object->_owner, internal::gdn_interface->classdb_get_class_tag(class_name._native_ptr()));
+	if (is_exact_class<T>(p_object)) {
+		return static_cast<T *>(p_object);
+	}
+	GDNativeObjectPtr casted = internal::gdn_interface->object_cast_to(p_object->_owner, internal::_get_class_tag<T>());
 	if (casted == nullptr) {
 		return nullptr;
 	}
-	return reinterpret_cast<T *>(internal::gdn_interface->object_get_instance_binding(casted, internal::token, &T::___binding_callbacks));
+	return reinterpret_cast<T *>(internal::InstanceBindingCache::get(casted, &T::___binding_callbacks));
 }
 
 template <class T>
@@ -150,12 +178,14 @@ const T *Object::cast_to(const Object *p_object) {
 	if (p_object == nullptr) {
 		return nullptr;
 	}
-	StringName class_name = T::get_class_static();
-	GDNativeObjectPtr casted = internal::gdn_interface->object_cast_to(p_object->_owner, internal::gdn_interface->classdb_get_class_tag(class_name._native_ptr()));
+	if (is_exact_class<T>(p_object)) {
+		return static_cast<const T *>(p_object);
+	}
+	GDNativeObjectPtr casted = internal::gdn_interface->object_cast_to(p_object->_owner, internal::_get_class_tag<T>());
 	if (casted == nullptr) {
 		return nullptr;
 	}
-	return reinterpret_cast<const T *>(internal::gdn_interface->object_get_instance_binding(casted, internal::token, &T::___binding_callbacks));
+	return reinterpret_cast<const T *>(internal::InstanceBindingCache::get(casted, &T::___binding_callbacks));
 }
 
 } // namespace godot
@@ -0,0 +1,65 @@
+/*************************************************************************/
+/*  property_accessor.hpp                                                */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef GODOT_PROPERTY_ACCESSOR_HPP
+#define GODOT_PROPERTY_ACCESSOR_HPP
+
+#include <godot_cpp/core/defs.hpp>
+#include <godot_cpp/core/name_map.hpp>
+
+#include <godot_cpp/variant/sname.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+#include <godot_cpp/variant/variant.hpp>
+
+#include <godot/gdnative_interface.h>
+
+namespace godot {
+
+// Direct access to one property of an extension class, registered with ClassDB::bind_property_accessor().
+// set_bind/get_bind use it before falling back to the class's _set()/_get().
+struct PropertyAccessor {
+	bool (*set)(GDExtensionClassInstancePtr p_instance, const Variant &p_value) = nullptr;
+	bool (*get)(GDExtensionClassInstancePtr p_instance, Variant &r_ret) = nullptr;
+};
+
+// Read by set_bind/get_bind on every property access, so it is flat and keyed by the interned name data.
+class PropertyAccessorMap : public NameMap<PropertyAccessor> {};
+
+namespace internal {
+
+_FORCE_INLINE_ const PropertyAccessor *find_property_accessor(const PropertyAccessorMap &p_map, const StringName &p_name) {
+	return p_map.getptr(p_name);
+}
+
+} // namespace internal
+
+} // namespace godot
+
+#endif // GODOT_PROPERTY_ACCESSOR_HPP
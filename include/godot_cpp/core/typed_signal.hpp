@@ -0,0 +1,118 @@
+/*************************************************************************/
+/*  typed_signal.hpp                                                     */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef GODOT_TYPED_SIGNAL_HPP
+#define GODOT_TYPED_SIGNAL_HPP
+
+#include <godot_cpp/core/defs.hpp>
+
+#include <godot_cpp/classes/object.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/object.hpp>
+#include <godot_cpp/core/type_info.hpp>
+#include <godot_cpp/variant/sname.hpp>
+#include <godot_cpp/variant/variant.hpp>
+
+#include <array>
+#include <cstdint>
+
+namespace godot {
+
+namespace internal {
+
+// Non-template part of TypedSignal. Like SNameSlot it is constant-initialized and trivially destructible;
+// the name packed as a Variant is created by bind() and released by clear() at core deinitialization.
+class TypedSignalBase {
+	mutable SNameSlot name_slot;
+	TypedSignalBase *next = nullptr;
+	alignas(Variant) uint8_t name_variant_storage[sizeof(Variant)] = {};
+
+protected:
+	const Variant *name_variant = nullptr;
+
+	void _bind(const StringName &p_class, const MethodInfo &p_info);
+
+public:
+	_FORCE_INLINE_ const StringName &get_name() const { return name_slot.get(); }
+	_FORCE_INLINE_ bool is_bound() const { return name_variant != nullptr; }
+
+	static void clear();
+
+	constexpr TypedSignalBase(const char *p_name) :
+			name_slot(p_name) {}
+};
+
+} // namespace internal
+
+// Handle for a signal with a fixed argument list, meant to be a static member of the class emitting it:
+//
+//     static inline TypedSignal<String, int> custom_signal{ "custom_signal" };
+//
+// bind() registers the signal from _bind_methods(), with one name per argument. emit() packs the arguments
+// into Variants on the stack next to the prepacked name and calls emit_signal() directly, skipping the
+// StringName and Variant the vararg Object::emit_signal() builds for the name on every call.
+template <class... Args>
+class TypedSignal : public internal::TypedSignalBase {
+	template <class T>
+	static PropertyInfo _make_argument_info(const StringName &p_name) {
+		PropertyInfo info = GetTypeInfo<T>::get_class_info();
+		info.name = p_name;
+		return info;
+	}
+
+public:
+	template <class... ArgNames>
+	void bind(const StringName &p_class, const ArgNames &...p_arg_names) {
+		static_assert(sizeof...(ArgNames) == sizeof...(Args), "TypedSignal::bind() needs one name per argument.");
+		MethodInfo info(get_name());
+		info.arguments = { _make_argument_info<Args>(p_arg_names)... };
+		_bind(p_class, info);
+	}
+
+	Error emit(Object *p_object, const Args &...p_args) const {
+		ERR_FAIL_NULL_V(p_object, ERR_INVALID_PARAMETER);
+		ERR_FAIL_COND_V_MSG(!is_bound(), ERR_UNCONFIGURED, "Signal \"" + String(get_name()) + "\" is emitted before being bound.");
+		std::array<Variant, sizeof...(Args)> variant_args{ { Variant(p_args)... } };
+		std::array<const Variant *, 1 + sizeof...(Args)> call_args;
+		call_args[0] = name_variant;
+		for (size_t i = 0; i < variant_args.size(); i++) {
+			call_args[i + 1] = &variant_args[i];
+		}
+		return p_object->emit_signal_packed(call_args.data(), call_args.size());
+	}
+
+	constexpr TypedSignal(const char *p_name) :
+			TypedSignalBase(p_name) {}
+};
+
+} // namespace godot
+
+#endif // GODOT_TYPED_SIGNAL_HPP
@@ -0,0 +1,527 @@
+/*************************************************************************/
+/*  rope.hpp                                                             */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef GODOT_ROPE_HPP
+#define GODOT_ROPE_HPP
+
+#include <godot_cpp/core/defs.hpp>
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/math.hpp>
+#include <godot_cpp/core/memory.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+#include <godot_cpp/godot.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+namespace godot {
+
+// Text buffer for large documents that are edited in place. The characters are kept in chunks, ordered by
+// position in a treap (a binary tree balanced through random priorities), so insertions, removals and
+// lookups take O(log n). Every node also counts the characters and the '\n' of its subtree, so lines are
+// found the same way as positions.
+class Rope {
+public:
+	static constexpr int CHUNK_CAPACITY = 1024;
+
+private:
+	struct Chunk {
+		Chunk *left = nullptr;
+		Chunk *right = nullptr;
+		uint32_t priority = 0;
+		int length = 0;
+		int lines = 0;
+		int64_t total_length = 0;
+		int64_t total_lines = 0;
+		char32_t chars[CHUNK_CAPACITY];
+	};
+
+	Chunk *root = nullptr;
+	uint32_t seed = 0x9E3779B9;
+
+	_FORCE_INLINE_ uint32_t _next_priority() {
+		// Xorshift32.
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+		return seed;
+	}
+
+	static _FORCE_INLINE_ int64_t _total_length(const Chunk *p_chunk) { return p_chunk ? p_chunk->total_length : 0; }
+	static _FORCE_INLINE_ int64_t _total_lines(const Chunk *p_chunk) { return p_chunk ? p_chunk->total_lines : 0; }
+
+	static _FORCE_INLINE_ void _update(Chunk *p_chunk) {
+		p_chunk->total_length = _total_length(p_chunk->left) + p_chunk->length + _total_length(p_chunk->right);
+		p_chunk->total_lines = _total_lines(p_chunk->left) + p_chunk->lines + _total_lines(p_chunk->right);
+	}
+
+	static int _count_lines(const char32_t *p_chars, int64_t p_length) {
+		int count = 0;
+		for (int64_t i = 0; i < p_length; i++) {
+			count += p_chars[i] == '\n';
+		}
+		return count;
+	}
+
+	Chunk *_new_chunk(const char32_t *p_chars, int p_length) {
+		Chunk *chunk = memnew(Chunk);
+		chunk->priority = _next_priority();
+		chunk->length = p_length;
+		chunk->lines = _count_lines(p_chars, p_length);
+		memcpy(chunk->chars, p_chars, p_length * sizeof(char32_t));
+		_update(chunk);
+		return chunk;
+	}
+
+	static void _free(Chunk *p_chunk) {
+		if (p_chunk) {
+			_free(p_chunk->left);
+			_free(p_chunk->right);
+			memdelete(p_chunk);
+		}
+	}
+
+	static Chunk *_clone(const Chunk *p_chunk) {
+		if (!p_chunk) {
+			return nullptr;
+		}
+		Chunk *chunk = memnew(Chunk(*p_chunk));
+		chunk->left = _clone(p_chunk->left);
+		chunk->right = _clone(p_chunk->right);
+		return chunk;
+	}
+
+	static Chunk *_merge(Chunk *p_left, Chunk *p_right) {
+		if (!p_left) {
+			return p_right;
+		}
+		if (!p_right) {
+			return p_left;
+		}
+		if (p_left->priority > p_right->priority) {
+			p_left->right = _merge(p_left->right, p_right);
+			_update(p_left);
+			return p_left;
+		}
+		p_right->left = _merge(p_left, p_right->left);
+		_update(p_right);
+		return p_right;
+	}
+
+	// Splits the subtree so that r_left holds its first p_pos characters. A chunk straddling p_pos is cut in two.
+	void _split(Chunk *p_chunk, int64_t p_pos, Chunk *&r_left, Chunk *&r_right) {
+		if (!p_chunk) {
+			r_left = nullptr;
+			r_right = nullptr;
+			return;
+		}
+		int64_t left_length = _total_length(p_chunk->left);
+		if (p_pos <= left_length) {
+			_split(p_chunk->left, p_pos, r_left, p_chunk->left);
+			_update(p_chunk);
+			r_right = p_chunk;
+		} else if (p_pos >= left_length + p_chunk->length) {
+			_split(p_chunk->right, p_pos - left_length - p_chunk->length, p_chunk->right, r_right);
+			_update(p_chunk);
+			r_left = p_chunk;
+		} else {
+			int offset = int(p_pos - left_length);
+			Chunk *tail = _new_chunk(p_chunk->chars + offset, p_chunk->length - offset);
+			p_chunk->length = offset;
+			p_chunk->lines -= tail->lines;
+			Chunk *right = p_chunk->right;
+			p_chunk->right = nullptr;
+			_update(p_chunk);
+			r_left = p_chunk;
+			r_right = _merge(tail, right);
+		}
+	}
+
+	static Chunk *_last(Chunk *p_chunk) {
+		while (p_chunk->right) {
+			p_chunk = p_chunk->right;
+		}
+		return p_chunk;
+	}
+
+	static Chunk *_first(Chunk *p_chunk) {
+		while (p_chunk->left) {
+			p_chunk = p_chunk->left;
+		}
+		return p_chunk;
+	}
+
+	// Detaches the first chunk of the subtree into r_first, and returns what remains.
+	static Chunk *_pop_first(Chunk *p_chunk, Chunk *&r_first) {
+		if (!p_chunk) {
+			r_first = nullptr;
+			return nullptr;
+		}
+		if (!p_chunk->left) {
+			r_first = p_chunk;
+			Chunk *right = p_chunk->right;
+			p_chunk->right = nullptr;
+			_update(p_chunk);
+			return right;
+		}
+		p_chunk->left = _pop_first(p_chunk->left, r_first);
+		_update(p_chunk);
+		return p_chunk;
+	}
+
+	// Detaches the last chunk of the subtree into r_last, and returns what remains.
+	static Chunk *_pop_last(Chunk *p_chunk, Chunk *&r_last) {
+		if (!p_chunk) {
+			r_last = nullptr;
+			return nullptr;
+		}
+		if (!p_chunk->right) {
+			r_last = p_chunk;
+			Chunk *left = p_chunk->left;
+			p_chunk->left = nullptr;
+			_update(p_chunk);
+			return left;
+		}
+		p_chunk->right = _pop_last(p_chunk->right, r_last);
+		_update(p_chunk);
+		return p_chunk;
+	}
+
+	// Appends the characters of p_tail to the last chunk of the subtree, which must have room for them.
+	static void _append_to_last(Chunk *p_chunk, const Chunk *p_tail) {
+		if (p_chunk->right) {
+			_append_to_last(p_chunk->right, p_tail);
+		} else {
+			memcpy(p_chunk->chars + p_chunk->length, p_tail->chars, p_tail->length * sizeof(char32_t));
+			p_chunk->length += p_tail->length;
+			p_chunk->lines += p_tail->lines;
+		}
+		_update(p_chunk);
+	}
+
+	// Merges two subtrees like _merge(), but first moves chunks at the start of p_right into the last chunk
+	// of p_left for as long as they fit, so edits don't leave runs of small chunks behind.
+	static Chunk *_join(Chunk *p_left, Chunk *p_right) {
+		while (p_left && p_right && _last(p_left)->length + _first(p_right)->length <= CHUNK_CAPACITY) {
+			Chunk *first;
+			p_right = _pop_first(p_right, first);
+			_append_to_last(p_left, first);
+			memdelete(first);
+		}
+		return _merge(p_left, p_right);
+	}
+
+	// Joins the parts left by splitting at an edit. The chunks on each side of the cuts may have been cut short,
+	// so they are detached and joined back one by one, each with its neighbours.
+	static Chunk *_join_edit(Chunk *p_left, Chunk *p_middle, Chunk *p_right) {
+		Chunk *head;
+		Chunk *tail;
+		p_left = _pop_last(p_left, head);
+		p_right = _pop_first(p_right, tail);
+		return _join(_join(_join(_join(p_left, head), p_middle), tail), p_right);
+	}
+
+	Chunk *_build(const char32_t *p_chars, int64_t p_length) {
+		Chunk *tree = nullptr;
+		for (int64_t i = 0; i < p_length; i += CHUNK_CAPACITY) {
+			int length = int(MIN(p_length - i, (int64_t)CHUNK_CAPACITY));
+			tree = _merge(tree, _new_chunk(p_chars + i, length));
+		}
+		return tree;
+	}
+
+	// Small edits that stay within one chunk are done in place, updating the counts along the path.
+	static bool _insert_in_place(Chunk *p_chunk, int64_t p_pos, const char32_t *p_chars, int p_length, int p_lines) {
+		if (!p_chunk) {
+			return false;
+		}
+		int64_t left_length = _total_length(p_chunk->left);
+		bool done;
+		if (p_pos < left_length) {
+			done = _insert_in_place(p_chunk->left, p_pos, p_chars, p_length, p_lines);
+		} else if (p_pos <= left_length + p_chunk->length) {
+			int offset = int(p_pos - left_length);
+			done = p_chunk->length + p_length <= CHUNK_CAPACITY;
+			if (done) {
+				memmove(p_chunk->chars + offset + p_length, p_chunk->chars + offset, (p_chunk->length - offset) * sizeof(char32_t));
+				memcpy(p_chunk->chars + offset, p_chars, p_length * sizeof(char32_t));
+				p_chunk->length += p_length;
+				p_chunk->lines += p_lines;
+			}
+		} else {
+			done = _insert_in_place(p_chunk->right, p_pos - left_length - p_chunk->length, p_chars, p_length, p_lines);
+		}
+		if (done) {
+			p_chunk->total_length += p_length;
+			p_chunk->total_lines += p_lines;
+		}
+		return done;
+	}
+
+	// Returns the number of removed lines, or -1 if the range doesn't fall strictly inside one chunk, or would
+	// leave it half empty (the split path then joins what remains with its neighbours).
+	static int _erase_in_place(Chunk *p_chunk, int64_t p_pos, int64_t p_length) {
+		if (!p_chunk) {
+			return -1;
+		}
+		int64_t left_length = _total_length(p_chunk->left);
+		int lines;
+		if (p_pos < left_length) {
+			lines = _erase_in_place(p_chunk->left, p_pos, p_length);
+		} else if (p_pos < left_length + p_chunk->length) {
+			int offset = int(p_pos - left_length);
+			if (offset + p_length >= p_chunk->length || p_chunk->length - p_length <= CHUNK_CAPACITY / 2) {
+				return -1;
+			}
+			lines = _count_lines(p_chunk->chars + offset, p_length);
+			memmove(p_chunk->chars + offset, p_chunk->chars + offset + p_length, (p_chunk->length - offset - p_length) * sizeof(char32_t));
+			p_chunk->length -= int(p_length);
+			p_chunk->lines -= lines;
+		} else {
+			lines = _erase_in_place(p_chunk->right, p_pos - left_length - p_chunk->length, p_length);
+		}
+		if (lines >= 0) {
+			p_chunk->total_length -= p_length;
+			p_chunk->total_lines -= lines;
+		}
+		return lines;
+	}
+
+	static void _copy(const Chunk *p_chunk, int64_t p_from, int64_t p_to, char32_t *r_dst) {
+		if (!p_chunk || p_from >= p_to) {
+			return;
+		}
+		int64_t left_length = _total_length(p_chunk->left);
+		if (p_from < left_length) {
+			_copy(p_chunk->left, p_from, MIN(p_to, left_length), r_dst);
+			r_dst += MIN(p_to, left_length) - p_from;
+		}
+		int64_t chunk_from = MAX(p_from - left_length, (int64_t)0);
+		int64_t chunk_to = MIN(p_to - left_length, (int64_t)p_chunk->length);
+		if (chunk_from < chunk_to) {
+			memcpy(r_dst, p_chunk->chars + chunk_from, (chunk_to - chunk_from) * sizeof(char32_t));
+			r_dst += chunk_to - chunk_from;
+		}
+		int64_t right_start = left_length + p_chunk->length;
+		if (p_to > right_start) {
+			_copy(p_chunk->right, MAX(p_from - right_start, (int64_t)0), p_to - right_start, r_dst);
+		}
+	}
+
+	static String _make_string(const char32_t *p_chars, int64_t p_length) {
+		String ret;
+		if (p_length > 0) {
+			internal::gdn_interface->string_new_with_utf32_chars_and_len(ret._native_ptr(), p_chars, p_length);
+		}
+		return ret;
+	}
+
+public:
+	_FORCE_INLINE_ int64_t length() const { return _total_length(root); }
+	_FORCE_INLINE_ bool is_empty() const { return root == nullptr; }
+	// Lines are separated by '\n', so there is always at least one.
+	_FORCE_INLINE_ int64_t get_line_count() const { return _total_lines(root) + 1; }
+
+	char32_t get(int64_t p_pos) const {
+		ERR_FAIL_INDEX_V(p_pos, length(), 0);
+		const Chunk *chunk = root;
+		while (true) {
+			int64_t left_length = _total_length(chunk->left);
+			if (p_pos < left_length) {
+				chunk = chunk->left;
+			} else if (p_pos < left_length + chunk->length) {
+				return chunk->chars[p_pos - left_length];
+			} else {
+				p_pos -= left_length + chunk->length;
+				chunk = chunk->right;
+			}
+		}
+	}
+	_FORCE_INLINE_ char32_t operator[](int64_t p_pos) const { return get(p_pos); }
+
+	void insert(int64_t p_pos, const char32_t *p_chars, int64_t p_length) {
+		ERR_FAIL_COND(p_pos < 0 || p_pos > length());
+		if (p_length <= 0) {
+			return;
+		}
+		if (p_length <= CHUNK_CAPACITY && _insert_in_place(root, p_pos, p_chars, int(p_length), _count_lines(p_chars, p_length))) {
+			return;
+		}
+		Chunk *left;
+		Chunk *right;
+		_split(root, p_pos, left, right);
+		root = _join_edit(left, _build(p_chars, p_length), right);
+	}
+
+	void insert(int64_t p_pos, const String &p_string) {
+		int64_t string_length = p_string.length();
+		if (string_length > 0) {
+			insert(p_pos, p_string.ptr(), string_length);
+		}
+	}
+
+	_FORCE_INLINE_ void append(const String &p_string) { insert(length(), p_string); }
+
+	void erase(int64_t p_pos, int64_t p_length) {
+		ERR_FAIL_COND(p_pos < 0 || p_length < 0 || p_pos + p_length > length());
+		if (p_length == 0 || _erase_in_place(root, p_pos, p_length) >= 0) {
+			return;
+		}
+		Chunk *left;
+		Chunk *middle;
+		Chunk *right;
+		_split(root, p_pos, left, right);
+		_split(right, p_length, middle, right);
+		_free(middle);
+		root = _join_edit(left, nullptr, right);
+	}
+
+	String substr(int64_t p_pos, int64_t p_length = -1) const {
+		int64_t total = length();
+		ERR_FAIL_COND_V(p_pos < 0 || p_pos > total, String());
+		if (p_length < 0 || p_pos + p_length > total) {
+			p_length = total - p_pos;
+		}
+		if (p_length == 0) {
+			return String();
+		}
+		char32_t *buffer = (char32_t *)memalloc(p_length * sizeof(char32_t));
+		_copy(root, p_pos, p_pos + p_length, buffer);
+		String ret = _make_string(buffer, p_length);
+		memfree(buffer);
+		return ret;
+	}
+
+	_FORCE_INLINE_ String as_string() const { return substr(0); }
+
+	// Position of the first character of p_line.
+	int64_t get_line_start(int64_t p_line) const {
+		ERR_FAIL_INDEX_V(p_line, get_line_count(), -1);
+		if (p_line == 0) {
+			return 0;
+		}
+		// Finds the p_line-th '\n', the line starts right after it.
+		int64_t remaining = p_line;
+		int64_t pos = 0;
+		const Chunk *chunk = root;
+		while (true) {
+			int64_t left_lines = _total_lines(chunk->left);
+			if (remaining <= left_lines) {
+				chunk = chunk->left;
+			} else if (remaining <= left_lines + chunk->lines) {
+				remaining -= left_lines;
+				pos += _total_length(chunk->left);
+				for (int i = 0; i < chunk->length; i++) {
+					if (chunk->chars[i] == '\n' && --remaining == 0) {
+						return pos + i + 1;
+					}
+				}
+				return -1; // Unreachable, the counts say the chunk holds it.
+			} else {
+				remaining -= left_lines + chunk->lines;
+				pos += _total_length(chunk->left) + chunk->length;
+				chunk = chunk->right;
+			}
+		}
+	}
+
+	// Line holding the character at p_pos (p_pos can be length(), the end of the last line).
+	int64_t get_line_at(int64_t p_pos) const {
+		ERR_FAIL_COND_V(p_pos < 0 || p_pos > length(), -1);
+		int64_t line = 0;
+		const Chunk *chunk = root;
+		while (chunk) {
+			int64_t left_length = _total_length(chunk->left);
+			if (p_pos < left_length) {
+				chunk = chunk->left;
+			} else {
+				line += _total_lines(chunk->left);
+				int64_t offset = p_pos - left_length;
+				if (offset < chunk->length) {
+					return line + _count_lines(chunk->chars, offset);
+				}
+				line += chunk->lines;
+				p_pos = offset - chunk->length;
+				chunk = chunk->right;
+			}
+		}
+		return line;
+	}
+
+	// Text of p_line, without its '\n'.
+	String get_line(int64_t p_line) const {
+		int64_t start = get_line_start(p_line);
+		ERR_FAIL_COND_V(start < 0, String());
+		int64_t end = p_line + 1 < get_line_count() ? get_line_start(p_line + 1) - 1 : length();
+		return substr(start, end - start);
+	}
+
+	void set_string(const String &p_string) {
+		clear();
+		int64_t string_length = p_string.length();
+		if (string_length > 0) {
+			root = _build(p_string.ptr(), string_length);
+		}
+	}
+
+	void clear() {
+		_free(root);
+		root = nullptr;
+	}
+
+	void operator=(const Rope &p_rope) {
+		if (this != &p_rope) {
+			clear();
+			root = _clone(p_rope.root);
+		}
+	}
+
+	void operator=(Rope &&p_rope) {
+		if (this != &p_rope) {
+			clear();
+			root = p_rope.root;
+			p_rope.root = nullptr;
+		}
+	}
+
+	Rope() {}
+	Rope(const String &p_string) { set_string(p_string); }
+	Rope(const Rope &p_rope) { root = _clone(p_rope.root); }
+	Rope(Rope &&p_rope) {
+		root = p_rope.root;
+		p_rope.root = nullptr;
+	}
+	~Rope() { clear(); }
+};
+
+} // namespace godot
+
+#endif // GODOT_ROPE_HPP
@@ -31,81 +31,64 @@
 #ifndef GODOT_CHAR_STRING_HPP
 #define GODOT_CHAR_STRING_HPP
 
+#include <godot_cpp/core/defs.hpp>
+
 #include <cstddef>
 #include <cstdint>
 
 namespace godot {
 
-class CharString {
+// Null terminated character data converted from a String. Short strings, like most names and paths,
+// are stored inline and don't allocate; longer ones spill over to the heap.
+template <class T>
+class CharStringT {
 	friend class String;
 
-	const char *_data = nullptr;
-	int _length = 0;
+	static constexpr int INLINE_BYTES = 32;
+	static constexpr int INLINE_CAPACITY = INLINE_BYTES / sizeof(T);
+
+	T *_data = nullptr;
+	int _length = 0; // Including the null terminator.
+	T _inline[INLINE_CAPACITY];
 
-	CharString(const char *str, int length);
+	// Makes room for p_length characters, null terminator included, and returns it for writing.
+	T *_alloc(int p_length);
+	void _free();
+	void _copy_from(const CharStringT &p_str);
+	void _move_from(CharStringT &p_str);
 
 public:
 	int length() const;
-	const char *get_data() const;
-
-	CharString(CharString &&p_str);
-	void operator=(CharString &&p_str);
-	CharString() {}
-	~CharString();
+	const T *get_data() const;
+	_FORCE_INLINE_ bool is_inline() const { return _data == _inline; }
+
+	CharStringT(const CharStringT &p_str);
+	CharStringT(CharStringT &&p_str);
+	CharStringT &operator=(const CharStringT &p_str);
+	CharStringT &operator=(CharStringT &&p_str);
+	CharStringT() {}
+	~CharStringT();
 };
 
-class Char16String {
-	friend class String;
-
-	const char16_t *_data = nullptr;
-	int _length = 0;
-
-	Char16String(const char16_t *str, int length);
-
+// Named classes rather than typedefs, so they can still be forward declared.
+class CharString : public CharStringT<char> {
 public:
-	int length() const;
-	const char16_t *get_data() const;
-
-	Char16String(Char16String &&p_str);
-	void operator=(Char16String &&p_str);
-	Char16String() {}
-	~Char16String();
+	using CharStringT::CharStringT;
 };
 
-class Char32String {
-	friend class String;
-
-	const char32_t *_data = nullptr;
-	int _length = 0;
-
-	Char32String(const char32_t *str, int length);
-
+class Char16String : public CharStringT<char16_t> {
 public:
-	int length() const;
-	const char32_t *get_data() const;
-
-	Char32String(Char32String &&p_str);
-	void operator=(Char32String &&p_str);
-	Char32String() {}
-	~Char32String();
+	using CharStringT::CharStringT;
 };
 
-class CharWideString {
-	friend class String;
-
-	const wchar_t *_data = nullptr;
-	int _length = 0;
-
-	CharWideString(const wchar_t *str, int length);
-
+class Char32String : public CharStringT<char32_t> {
 public:
-	int length() const;
-	const wchar_t *get_data() const;
+	using CharStringT::CharStringT;
+};
 
-	CharWideString(CharWideString &&p_str);
-	void operator=(CharWideString &&p_str);
-	CharWideString() {}
-	~CharWideString();
+class CharWideString : public CharStringT<wchar_t> {
+public:
+	using CharStringT::CharStringT;
 };
 
 } // namespace godot
@@ -31,6 +31,10 @@
 #ifndef GODOT_CHAR_UTILS_HPP
 #define GODOT_CHAR_UTILS_HPP
 
+#include <godot_cpp/core/defs.hpp>
+
+#include <cstdint>
+
 static _FORCE_INLINE_ bool is_ascii_upper_case(char32_t c) {
 	return (c >= 'A' && c <= 'Z');
 }
@@ -87,4 +91,16 @@ static _FORCE_INLINE_ bool is_underscore(char32_t p_char) {
 	return (p_char == '_');
 }
 
+namespace godot {
+
+// Scanning over character buffers, such as String::ptr(). They give the same results as the predicates above
+// applied to each character. Positions are returned as indices, p_length when nothing is found.
+int64_t find_first_non_whitespace(const char32_t *p_str, int64_t p_length);
+int64_t find_first_of(const char32_t *p_str, int64_t p_length, const char32_t *p_set, int64_t p_set_length);
+int64_t count_linebreaks(const char32_t *p_str, int64_t p_length);
+// Same rules as String::is_valid_identifier().
+bool is_valid_identifier(const char32_t *p_str, int64_t p_length);
+
+} // namespace godot
+
 #endif // GODOT_CHAR_UTILS_HPP
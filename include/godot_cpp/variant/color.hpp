@@ -35,6 +35,9 @@
 
 namespace godot {
 
+class PackedByteArray;
+class PackedColorArray;
+class PackedStringArray;
 class String;
 
 struct _NO_DISCARD_ Color {
@@ -190,6 +193,17 @@ struct _NO_DISCARD_ Color {
 	static Color hex64(uint64_t p_hex);
 	static Color html(const String &p_rgba);
 	static bool html_is_valid(const String &p_color);
+	// Parse characters the caller already has, e.g. from String::ptr(), and report invalid codes
+	// through the return value. html() and html_is_valid() go through these.
+	static bool html_parse(const char *p_rgba, int64_t p_length, Color &r_color);
+	static bool html_parse(const char32_t *p_rgba, int64_t p_length, Color &r_color);
+	// Writes 6 or 8 lowercase hex digits and a null terminator, r_buffer must hold 9 characters.
+	// Returns the number of digits.
+	int to_html_chars(char *r_buffer, bool p_alpha = true) const;
+	// Invalid codes become p_default.
+	static PackedColorArray html_batch(const PackedStringArray &p_codes, const Color &p_default = Color());
+	// Four bytes per color, in RGBA order, rounded like get_r8() and friends.
+	static PackedByteArray to_rgba8_batch(const PackedColorArray &p_colors);
 	static Color named(const String &p_name);
 	static Color named(const String &p_name, const Color &p_default);
 	static int find_named_color(const String &p_name);
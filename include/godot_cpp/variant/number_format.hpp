@@ -0,0 +1,70 @@
+/*************************************************************************/
+/*  number_format.hpp                                                    */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef GODOT_NUMBER_FORMAT_HPP
+#define GODOT_NUMBER_FORMAT_HPP
+
+#include <godot_cpp/core/defs.hpp>
+
+#include <cstdint>
+
+namespace godot {
+
+namespace internal {
+
+// Numbers are formatted into caller buffers, with the same output as the engine's String::num_int64(),
+// num_uint64(), num() and num_scientific(). None of them writes a null terminator, they return the length.
+
+// Sign and 20 digits.
+static constexpr int INT_FORMAT_MAX_LENGTH = 21;
+// Sign, 309 integer digits, the point and 32 decimals.
+static constexpr int REAL_FORMAT_MAX_LENGTH = 343;
+
+int format_int(int64_t p_num, char *r_buffer);
+int format_uint(uint64_t p_num, char *r_buffer);
+// A negative p_decimals picks the engine default (14 significant digits for numbers above 10).
+int format_real(double p_num, int p_decimals, char *r_buffer);
+int format_real_scientific(double p_num, char *r_buffer);
+
+// The digits String::num() keeps for p_num when called without p_decimals.
+int default_real_decimals(double p_num);
+
+// Parsers following the engine's static String::to_int() and to_float() for C strings. A negative p_len reads
+// up to the null terminator.
+int64_t parse_int(const char *p_str, int p_len);
+int64_t parse_int(const char32_t *p_str, int p_len, bool p_clamp);
+double parse_float(const char *p_str);
+double parse_float(const char32_t *p_str);
+
+} // namespace internal
+
+} // namespace godot
+
+#endif // GODOT_NUMBER_FORMAT_HPP
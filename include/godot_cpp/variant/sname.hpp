@@ -0,0 +1,111 @@
+/*************************************************************************/
+/*  sname.hpp                                                            */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef GODOT_SNAME_HPP
+#define GODOT_SNAME_HPP
+
+#include <godot_cpp/core/defs.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace godot {
+
+namespace internal {
+
+// Equal StringNames share the same interned data in the engine, so containers keyed by names can hash and
+// compare that pointer instead of calling into the engine. The hasher and comparator work both with
+// std containers and with the ones in godot_cpp/templates.
+static_assert(sizeof(StringName) == sizeof(void *), "StringName is expected to hold a single pointer.");
+
+_FORCE_INLINE_ const void *_string_name_data(const StringName &p_name) {
+	return *reinterpret_cast<const void *const *>(p_name._native_ptr());
+}
+
+struct StringNameDataHasher {
+	static _FORCE_INLINE_ uint32_t hash_data(const void *p_data) {
+		// Same mix as hash_one_uint64(), the low bits of a pointer are mostly zero.
+		uint64_t v = (uint64_t)(uintptr_t)p_data;
+		v = (~v) + (v << 18);
+		v = v ^ (v >> 31);
+		v = v * 21;
+		v = v ^ (v >> 11);
+		v = v + (v << 6);
+		v = v ^ (v >> 22);
+		return uint32_t(v);
+	}
+	static _FORCE_INLINE_ uint32_t hash(const StringName &p_name) { return hash_data(_string_name_data(p_name)); }
+	_FORCE_INLINE_ std::size_t operator()(const StringName &p_name) const { return hash(p_name); }
+};
+
+struct StringNameDataComparator {
+	static _FORCE_INLINE_ bool compare(const StringName &p_a, const StringName &p_b) {
+		return _string_name_data(p_a) == _string_name_data(p_b);
+	}
+	_FORCE_INLINE_ bool operator()(const StringName &p_a, const StringName &p_b) const { return compare(p_a, p_b); }
+};
+
+// Storage for one SNAME() call site. It is constant-initialized and trivially destructible, so the
+// function-local static behind SNAME() needs neither an init guard nor an exit-time destructor. The name is
+// interned on first use and released again by clear(), when the extension is deinitialized at the core
+// level, while the engine is still around to release it.
+class SNameSlot {
+	const char *name;
+	std::atomic<StringName *> value;
+	SNameSlot *next = nullptr;
+	alignas(StringName) uint8_t storage[sizeof(StringName)] = {};
+
+	StringName *_intern();
+
+public:
+	_FORCE_INLINE_ const StringName &get() {
+		StringName *sname = value.load(std::memory_order_acquire);
+		if (unlikely(sname == nullptr)) {
+			sname = _intern();
+		}
+		return *sname;
+	}
+
+	static void clear();
+
+	constexpr SNameSlot(const char *p_name) :
+			name(p_name), value(nullptr) {}
+};
+
+} // namespace internal
+
+// Interns a string literal once per process, instead of building a StringName from it on every use.
+#define SNAME(m_arg) ([]() -> const ::godot::StringName & { static ::godot::internal::SNameSlot sname_slot(m_arg); return sname_slot.get(); })()
+
+} // namespace godot
+
+#endif // GODOT_SNAME_HPP
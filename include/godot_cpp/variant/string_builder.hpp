@@ -0,0 +1,97 @@
+/*************************************************************************/
+/*  string_builder.hpp                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef GODOT_STRING_BUILDER_HPP
+#define GODOT_STRING_BUILDER_HPP
+
+#include <godot_cpp/core/defs.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+#include <cstdint>
+
+namespace godot {
+
+// Accumulates text in a local UTF-32 buffer, growing geometrically, and creates the engine String only once in
+// as_string(). Chaining String operator+ instead creates (and copies into) a new engine String at every step.
+class StringBuilder {
+	char32_t *buffer = nullptr;
+	int64_t length = 0;
+	int64_t capacity = 0;
+	int appended = 0;
+
+	void _grow(int64_t p_min_capacity);
+	void _append_ascii(const char *p_chars, int p_length);
+
+	_FORCE_INLINE_ char32_t *_reserve_tail(int64_t p_count) {
+		if (unlikely(length + p_count > capacity)) {
+			_grow(length + p_count);
+		}
+		return buffer + length;
+	}
+
+public:
+	StringBuilder &append(const String &p_string);
+	StringBuilder &append(const char *p_cstring); // Latin-1, like the String constructor.
+	StringBuilder &append(const char32_t *p_cstring);
+	StringBuilder &append(char32_t p_char);
+	StringBuilder &append_utf8(const char *p_utf8, int64_t p_length = -1);
+
+	// Numbers are formatted locally, with the same output as itos(), uitos() and String::num().
+	StringBuilder &append_int(int64_t p_num);
+	StringBuilder &append_uint(uint64_t p_num);
+	StringBuilder &append_real(double p_num, int p_decimals = -1);
+
+	_FORCE_INLINE_ StringBuilder &operator+(const String &p_string) { return append(p_string); }
+	_FORCE_INLINE_ StringBuilder &operator+(const char *p_cstring) { return append(p_cstring); }
+	_FORCE_INLINE_ StringBuilder &operator+(const char32_t *p_cstring) { return append(p_cstring); }
+	_FORCE_INLINE_ StringBuilder &operator+=(const String &p_string) { return append(p_string); }
+	_FORCE_INLINE_ StringBuilder &operator+=(const char *p_cstring) { return append(p_cstring); }
+	_FORCE_INLINE_ StringBuilder &operator+=(const char32_t *p_cstring) { return append(p_cstring); }
+
+	void reserve(int64_t p_length);
+	void clear();
+
+	_FORCE_INLINE_ int num_strings_appended() const { return appended; }
+	_FORCE_INLINE_ int64_t get_string_length() const { return length; }
+
+	String as_string() const;
+	_FORCE_INLINE_ operator String() const { return as_string(); }
+
+	StringBuilder() {}
+	StringBuilder(const StringBuilder &p_other);
+	StringBuilder(StringBuilder &&p_other);
+	StringBuilder &operator=(const StringBuilder &p_other);
+	StringBuilder &operator=(StringBuilder &&p_other);
+	~StringBuilder();
+};
+
+} // namespace godot
+
+#endif // GODOT_STRING_BUILDER_HPP
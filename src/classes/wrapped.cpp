@@ -56,6 +56,31 @@ Wrapped::Wrapped(GodotObject *p_godot_object) {
 	_owner = p_godot_object;
 }
 
+void internal::PropertyListCache::build() {
+	list = reinterpret_cast<GDNativePropertyInfo *>(memalloc(sizeof(GDNativePropertyInfo) * owned.size()));
+	size = 0;
+	for (const PropertyInfo &E : owned) {
+		list[size].type = static_cast<GDNativeVariantType>(E.type);
+		list[size].name = E.name._native_ptr();
+		list[size].hint = E.hint;
+		list[size].hint_string = E.hint_string._native_ptr();
+		list[size].class_name = E.class_name._native_ptr();
+		list[size].usage = E.usage;
+		size++;
+	}
+	dirty = false;
+}
+
+void internal::PropertyListCache::clear() {
+	if (list) {
+		memfree(list);
+	}
+	list = nullptr;
+	size = 0;
+	owned.clear();
+	dirty = true;
+}
+
 void postinitialize_handler(Wrapped *p_wrapped) {
 	p_wrapped->_postinitialize();
 }
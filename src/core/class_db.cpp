@@ -34,42 +34,186 @@
 #include <godot_cpp/godot.hpp>
 
 #include <godot_cpp/core/memory.hpp>
+#include <godot_cpp/templates/hashfuncs.hpp>
 
 #include <algorithm>
+#include <chrono>
 
 namespace godot {
 
-std::unordered_map<StringName, ClassDB::ClassInfo> ClassDB::classes;
+NameMap<ClassDB::ClassInfo> ClassDB::classes;
 GDNativeInitializationLevel ClassDB::current_level = GDNATIVE_INITIALIZATION_CORE;
 
-MethodDefinition D_METHOD(StringName p_name) {
-	return MethodDefinition(p_name);
+// Scratch buffers for bind_method_godot(). Registration binds methods one after the other on a single thread,
+// so they are reused for every method instead of being allocated again each time, and released with the
+// classes of the last initialization level.
+static struct MethodRegistrationScratch {
+	std::vector<PropertyInfo> arguments_info;
+	std::vector<GDNativePropertyInfo> arguments_gdnative_info;
+	std::vector<GDNativeExtensionClassMethodArgumentMetadata> arguments_metadata;
+	std::vector<GDNativeVariantPtr> default_arguments;
+
+	void release() {
+		std::vector<PropertyInfo>().swap(arguments_info);
+		std::vector<GDNativePropertyInfo>().swap(arguments_gdnative_info);
+		std::vector<GDNativeExtensionClassMethodArgumentMetadata>().swap(arguments_metadata);
+		std::vector<GDNativeVariantPtr>().swap(default_arguments);
+	}
+} method_registration_scratch;
+
+static void submit_method(const StringName &p_class_name, MethodBind *p_method);
+
+// Engine side registration of a class whose _bind_methods() is running. Everything is validated and recorded
+// in ClassInfo right away, but the interface calls are queued in their original order (groups must precede
+// their properties, methods the properties using them) and submitted back to back by initialize_class().
+struct RegistrationBatch {
+	enum Type {
+		METHOD,
+		PROPERTY,
+		PROPERTY_GROUP,
+		PROPERTY_SUBGROUP,
+		SIGNAL,
+		INTEGER_CONSTANT,
+	};
+
+	struct Entry {
+		Type type;
+		uint32_t index;
+	};
+
+	struct Property {
+		PropertyInfo info;
+		StringName setter;
+		StringName getter;
+	};
+
+	struct Group {
+		String name;
+		String prefix;
+	};
+
+	struct Constant {
+		StringName enum_name;
+		StringName constant_name;
+		GDNativeInt value;
+		bool is_bitfield;
+	};
+
+	StringName class_name;
+	std::chrono::steady_clock::time_point start;
+
+	std::vector<Entry> entries;
+	std::vector<MethodBind *> methods;
+	std::vector<Property> properties;
+	std::vector<Group> groups;
+	std::vector<MethodInfo> signals;
+	std::vector<Constant> constants;
+
+	void submit() const;
+};
+
+// A stack, since a class may register another one from its _bind_methods().
+static std::vector<RegistrationBatch> registration_batches;
+
+static RegistrationBatch *get_registration_batch(const StringName &p_class) {
+	if (registration_batches.empty() || !internal::StringNameDataComparator::compare(registration_batches.back().class_name, p_class)) {
+		return nullptr;
+	}
+	return &registration_batches.back();
 }
 
-MethodDefinition D_METHOD(StringName p_name, StringName p_arg1) {
-	MethodDefinition method(p_name);
-	method.args.push_front(p_arg1);
-	return method;
+static void submit_property(const StringName &p_class, const PropertyInfo &p_pinfo, const StringName &p_setter, const StringName &p_getter) {
+	GDNativePropertyInfo prop_info = {
+		static_cast<GDNativeVariantType>(p_pinfo.type), // GDNativeVariantType type;
+		p_pinfo.name._native_ptr(), // GDNativeStringNamePtr name;
+		p_pinfo.class_name._native_ptr(), // GDNativeStringNamePtr class_name;
+		p_pinfo.hint, // NONE //uint32_t hint;
+		p_pinfo.hint_string._native_ptr(), // GDNativeStringPtr hint_string;
+		p_pinfo.usage, // DEFAULT //uint32_t usage;
+	};
+
+	internal::gdn_interface->classdb_register_extension_class_property(internal::library, p_class._native_ptr(), &prop_info, p_setter._native_ptr(), p_getter._native_ptr());
+}
+
+static void submit_signal(const StringName &p_class, const MethodInfo &p_signal) {
+	std::vector<GDNativePropertyInfo> parameters;
+	parameters.reserve(p_signal.arguments.size());
+
+	for (const PropertyInfo &par : p_signal.arguments) {
+		parameters.push_back(GDNativePropertyInfo{
+				static_cast<GDNativeVariantType>(par.type), // GDNativeVariantType type;
+				par.name._native_ptr(), // GDNativeStringNamePtr name;
+				par.class_name._native_ptr(), // GDNativeStringNamePtr class_name;
+				par.hint, // NONE //uint32_t hint;
+				par.hint_string._native_ptr(), // GDNativeStringPtr hint_string;
+				par.usage, // DEFAULT //uint32_t usage;
+		});
+	}
+
+	internal::gdn_interface->classdb_register_extension_class_signal(internal::library, p_class._native_ptr(), p_signal.name._native_ptr(), parameters.data(), parameters.size());
+}
+
+void RegistrationBatch::submit() const {
+	for (const Entry &entry : entries) {
+		switch (entry.type) {
+			case METHOD: {
+				submit_method(class_name, methods[entry.index]);
+			} break;
+			case PROPERTY: {
+				const Property &property = properties[entry.index];
+				submit_property(class_name, property.info, property.setter, property.getter);
+			} break;
+			case PROPERTY_GROUP: {
+				const Group &group = groups[entry.index];
+				internal::gdn_interface->classdb_register_extension_class_property_group(internal::library, class_name._native_ptr(), group.name._native_ptr(), group.prefix._native_ptr());
+			} break;
+			case PROPERTY_SUBGROUP: {
+				const Group &group = groups[entry.index];
+				internal::gdn_interface->classdb_register_extension_class_property_subgroup(internal::library, class_name._native_ptr(), group.name._native_ptr(), group.prefix._native_ptr());
+			} break;
+			case SIGNAL: {
+				submit_signal(class_name, signals[entry.index]);
+			} break;
+			case INTEGER_CONSTANT: {
+				const Constant &constant = constants[entry.index];
+				internal::gdn_interface->classdb_register_extension_class_integer_constant(internal::library, class_name._native_ptr(), constant.enum_name._native_ptr(), constant.constant_name._native_ptr(), constant.value, constant.is_bitfield);
+			} break;
+		}
+	}
 }
 
 void ClassDB::add_property_group(const StringName &p_class, const String &p_name, const String &p_prefix) {
-	ERR_FAIL_COND_MSG(classes.find(p_class) == classes.end(), String("Trying to add property '{0}{1}' to non-existing class '{2}'.").format(Array::make(p_prefix, p_name, p_class)));
+	ERR_FAIL_COND_MSG(!classes.has(p_class), String("Trying to add property '{0}{1}' to non-existing class '{2}'.").format(Array::make(p_prefix, p_name, p_class)));
+
+	RegistrationBatch *batch = get_registration_batch(p_class);
+	if (batch) {
+		batch->entries.push_back({ RegistrationBatch::PROPERTY_GROUP, (uint32_t)batch->groups.size() });
+		batch->groups.push_back({ p_name, p_prefix });
+		return;
+	}
 
 	internal::gdn_interface->classdb_register_extension_class_property_group(internal::library, p_class._native_ptr(), p_name._native_ptr(), p_prefix._native_ptr());
 }
 
 void ClassDB::add_property_subgroup(const StringName &p_class, const String &p_name, const String &p_prefix) {
-	ERR_FAIL_COND_MSG(classes.find(p_class) == classes.end(), String("Trying to add property '{0}{1}' to non-existing class '{2}'.").format(Array::make(p_prefix, p_name, p_class)));
+	ERR_FAIL_COND_MSG(!classes.has(p_class), String("Trying to add property '{0}{1}' to non-existing class '{2}'.").format(Array::make(p_prefix, p_name, p_class)));
+
+	RegistrationBatch *batch = get_registration_batch(p_class);
+	if (batch) {
+		batch->entries.push_back({ RegistrationBatch::PROPERTY_SUBGROUP, (uint32_t)batch->groups.size() });
+		batch->groups.push_back({ p_name, p_prefix });
+		return;
+	}
 
 	internal::gdn_interface->classdb_register_extension_class_property_subgroup(internal::library, p_class._native_ptr(), p_name._native_ptr(), p_prefix._native_ptr());
 }
 
 void ClassDB::add_property(const StringName &p_class, const PropertyInfo &p_pinfo, const StringName &p_setter, const StringName &p_getter, int p_index) {
-	ERR_FAIL_COND_MSG(classes.find(p_class) == classes.end(), String("Trying to add property '{0}' to non-existing class '{1}'.").format(Array::make(p_pinfo.name, p_class)));
+	ERR_FAIL_COND_MSG(!classes.has(p_class), String("Trying to add property '{0}' to non-existing class '{1}'.").format(Array::make(p_pinfo.name, p_class)));
 
 	ClassInfo &info = classes[p_class];
 
-	ERR_FAIL_COND_MSG(info.property_names.find(p_pinfo.name) != info.property_names.end(), String("Property '{0}' already exists in class '{1}'.").format(Array::make(p_pinfo.name, p_class)));
+	ERR_FAIL_COND_MSG(info.property_names.has(p_pinfo.name), String("Property '{0}' already exists in class '{1}'.").format(Array::make(p_pinfo.name, p_class)));
 
 	MethodBind *setter = nullptr;
 	if (p_setter != String("")) {
@@ -94,34 +238,24 @@ void ClassDB::add_property(const StringName &p_class, const PropertyInfo &p_pinf
 	info.property_names.insert(p_pinfo.name);
 
 	// register with Godot
-	GDNativePropertyInfo prop_info = {
-		static_cast<GDNativeVariantType>(p_pinfo.type), // GDNativeVariantType type;
-		p_pinfo.name._native_ptr(), // GDNativeStringNamePtr name;
-		p_pinfo.class_name._native_ptr(), // GDNativeStringNamePtr class_name;
-		p_pinfo.hint, // NONE //uint32_t hint;
-		p_pinfo.hint_string._native_ptr(), // GDNativeStringPtr hint_string;
-		p_pinfo.usage, // DEFAULT //uint32_t usage;
-	};
-
-	PropertySetGet setget;
-	setget.setter = p_setter;
-	setget.getter = p_getter;
-	setget._setptr = setter;
-	setget._getptr = getter;
-	setget.index = p_index;
-	setget.type = p_pinfo.type;
+	RegistrationBatch *batch = get_registration_batch(info.name);
+	if (batch) {
+		batch->entries.push_back({ RegistrationBatch::PROPERTY, (uint32_t)batch->properties.size() });
+		batch->properties.push_back({ p_pinfo, p_setter, p_getter });
+		return;
+	}
 
-	internal::gdn_interface->classdb_register_extension_class_property(internal::library, info.name._native_ptr(), &prop_info, setget.setter._native_ptr(), setget.getter._native_ptr());
+	submit_property(info.name, p_pinfo, p_setter, p_getter);
 }
 
 MethodBind *ClassDB::get_method(const StringName &p_class, const StringName &p_method) {
-	ERR_FAIL_COND_V_MSG(classes.find(p_class) == classes.end(), nullptr, String("Class '{0}' not found.").format(Array::make(p_class)));
+	ClassInfo *type = classes.getptr(p_class);
+	ERR_FAIL_COND_V_MSG(!type, nullptr, String("Class '{0}' not found.").format(Array::make(p_class)));
 
-	ClassInfo *type = &classes[p_class];
 	while (type) {
-		std::unordered_map<StringName, MethodBind *>::iterator method = type->method_map.find(p_method);
-		if (method != type->method_map.end()) {
-			return method->second;
+		MethodBind *const *method = type->method_map.getptr(p_method);
+		if (method) {
+			return *method;
 		}
 		type = type->parent_ptr;
 		continue;
@@ -130,57 +264,55 @@ MethodBind *ClassDB::get_method(const StringName &p_class, const StringName &p_m
 	return nullptr;
 }
 
-MethodBind *ClassDB::bind_methodfi(uint32_t p_flags, MethodBind *p_bind, const MethodDefinition &method_name, const void **p_defs, int p_defcount) {
+const InstancePool *ClassDB::get_instance_pool(const StringName &p_class) {
+	const ClassInfo *type = classes.getptr(p_class);
+	ERR_FAIL_COND_V_MSG(!type, nullptr, String("Class '{0}' not found.").format(Array::make(p_class)));
+	return type->instance_pool;
+}
+
+MethodBind *ClassDB::bind_methodfi(uint32_t p_flags, MethodBind *p_bind, const StringName &p_name, const StringName *p_arg_names, int p_arg_count, const void **p_defs, int p_defcount) {
 	StringName instance_type = p_bind->get_instance_class();
 
-	std::unordered_map<StringName, ClassInfo>::iterator type_it = classes.find(instance_type);
-	if (type_it == classes.end()) {
+	ClassInfo *type_ptr = classes.getptr(instance_type);
+	if (!type_ptr) {
 		memdelete(p_bind);
 		ERR_FAIL_V_MSG(nullptr, String("Class '{0}' doesn't exist.").format(Array::make(instance_type)));
 	}
 
-	ClassInfo &type = type_it->second;
+	ClassInfo &type = *type_ptr;
 
-	if (type.method_map.find(method_name.name) != type.method_map.end()) {
+	if (type.method_map.has(p_name)) {
 		memdelete(p_bind);
-		ERR_FAIL_V_MSG(nullptr, String("Binding duplicate method: {0}::{1}().").format(Array::make(instance_type, method_name.name)));
+		ERR_FAIL_V_MSG(nullptr, String("Binding duplicate method: {0}::{1}().").format(Array::make(instance_type, p_name)));
 	}
 
-	if (type.virtual_methods.find(method_name.name) != type.virtual_methods.end()) {
+	if (type.virtual_methods.has(p_name)) {
 		memdelete(p_bind);
-		ERR_FAIL_V_MSG(nullptr, String("Method '{0}::{1}()' already bound as virtual.").format(Array::make(instance_type, method_name.name)));
+		ERR_FAIL_V_MSG(nullptr, String("Method '{0}::{1}()' already bound as virtual.").format(Array::make(instance_type, p_name)));
 	}
 
-	p_bind->set_name(method_name.name);
+	p_bind->set_name(p_name);
 
-	if (method_name.args.size() > p_bind->get_argument_count()) {
+	if (p_arg_count > p_bind->get_argument_count()) {
 		memdelete(p_bind);
-		ERR_FAIL_V_MSG(nullptr, String("Method '{0}::{1}()' definition has more arguments than the actual method.").format(Array::make(instance_type, method_name.name)));
+		ERR_FAIL_V_MSG(nullptr, String("Method '{0}::{1}()' definition has more arguments than the actual method.").format(Array::make(instance_type, p_name)));
 	}
 
 	p_bind->set_hint_flags(p_flags);
 
-	std::vector<StringName> args;
-	args.resize(method_name.args.size());
-	size_t arg_index = 0;
-	for (StringName arg : method_name.args) {
-		args[arg_index++] = arg;
-	}
-
-	p_bind->set_argument_names(args);
+	p_bind->set_argument_names(std::vector<StringName>(p_arg_names, p_arg_names + p_arg_count));
 
 	std::vector<Variant> defvals;
-
-	defvals.resize(p_defcount);
+	defvals.reserve(p_defcount);
 	for (int i = 0; i < p_defcount; i++) {
-		defvals[i] = *static_cast<const Variant *>(p_defs[i]);
+		defvals.push_back(*static_cast<const Variant *>(p_defs[i]));
 	}
 
-	p_bind->set_default_arguments(defvals);
+	p_bind->set_default_arguments(std::move(defvals));
 	p_bind->set_hint_flags(p_flags);
 
 	// register our method bind within our plugin
-	type.method_map[method_name.name] = p_bind;
+	type.method_map[p_name] = p_bind;
 
 	// and register with godot
 	bind_method_godot(type.name, p_bind);
@@ -189,18 +321,38 @@ MethodBind *ClassDB::bind_methodfi(uint32_t p_flags, MethodBind *p_bind, const M
 }
 
 void ClassDB::bind_method_godot(const StringName &p_class_name, MethodBind *p_method) {
-	std::vector<GDNativeVariantPtr> def_args;
+	RegistrationBatch *batch = get_registration_batch(p_class_name);
+	if (batch) {
+		batch->entries.push_back({ RegistrationBatch::METHOD, (uint32_t)batch->methods.size() });
+		batch->methods.push_back(p_method);
+		return;
+	}
+
+	submit_method(p_class_name, p_method);
+}
+
+static void submit_method(const StringName &p_class_name, MethodBind *p_method) {
+	MethodRegistrationScratch &scratch = method_registration_scratch;
+
+	std::vector<GDNativeVariantPtr> &def_args = scratch.default_arguments;
 	const std::vector<Variant> &def_args_val = p_method->get_default_arguments();
-	def_args.resize(def_args_val.size());
+	def_args.clear();
 	for (int i = 0; i < def_args_val.size(); i++) {
-		def_args[i] = (GDNativeVariantPtr)&def_args_val[i];
+		def_args.push_back((GDNativeVariantPtr)&def_args_val[i]);
 	}
 
-	std::vector<PropertyInfo> return_value_and_arguments_info = p_method->get_arguments_info_list();
-	std::vector<GDNativeExtensionClassMethodArgumentMetadata> return_value_and_arguments_metadata = p_method->get_arguments_metadata_list();
+	// Index 0 holds the return value, arguments follow.
+	std::vector<PropertyInfo> &return_value_and_arguments_info = scratch.arguments_info;
+	std::vector<GDNativeExtensionClassMethodArgumentMetadata> &return_value_and_arguments_metadata = scratch.arguments_metadata;
+	return_value_and_arguments_info.clear();
+	return_value_and_arguments_metadata.clear();
+	for (int i = -1; i < p_method->get_argument_count(); i++) {
+		return_value_and_arguments_info.push_back(p_method->get_argument_info(i));
+		return_value_and_arguments_metadata.push_back(p_method->get_argument_metadata(i));
+	}
 
-	std::vector<GDNativePropertyInfo> return_value_and_arguments_gdnative_info;
-	return_value_and_arguments_gdnative_info.reserve(return_value_and_arguments_info.size());
+	std::vector<GDNativePropertyInfo> &return_value_and_arguments_gdnative_info = scratch.arguments_gdnative_info;
+	return_value_and_arguments_gdnative_info.clear();
 	for (std::vector<PropertyInfo>::iterator it = return_value_and_arguments_info.begin(); it != return_value_and_arguments_info.end(); it++) {
 		return_value_and_arguments_gdnative_info.push_back(
 				GDNativePropertyInfo{
@@ -238,16 +390,16 @@ void ClassDB::bind_method_godot(const StringName &p_class_name, MethodBind *p_me
 }
 
 void ClassDB::add_signal(const StringName &p_class, const MethodInfo &p_signal) {
-	std::unordered_map<StringName, ClassInfo>::iterator type_it = classes.find(p_class);
+	ClassInfo *type_ptr = classes.getptr(p_class);
 
-	ERR_FAIL_COND_MSG(type_it == classes.end(), String("Class '{0}' doesn't exist.").format(Array::make(p_class)));
+	ERR_FAIL_COND_MSG(!type_ptr, String("Class '{0}' doesn't exist.").format(Array::make(p_class)));
 
-	ClassInfo &cl = type_it->second;
+	ClassInfo &cl = *type_ptr;
 
 	// Check if this signal is already register
 	ClassInfo *check = &cl;
 	while (check) {
-		ERR_FAIL_COND_MSG(check->signal_names.find(p_signal.name) != check->signal_names.end(), String("Class '{0}' already has signal '{1}'.").format(Array::make(p_class, p_signal.name)));
+		ERR_FAIL_COND_MSG(check->signal_names.has(p_signal.name), String("Class '{0}' already has signal '{1}'.").format(Array::make(p_class, p_signal.name)));
 		check = check->parent_ptr;
 	}
 
@@ -255,83 +407,159 @@ void ClassDB::add_signal(const StringName &p_class, const MethodInfo &p_signal)
 	cl.signal_names.insert(p_signal.name);
 
 	// register our signal in godot
-	std::vector<GDNativePropertyInfo> parameters;
-	parameters.reserve(p_signal.arguments.size());
-
-	for (const PropertyInfo &par : p_signal.arguments) {
-		parameters.push_back(GDNativePropertyInfo{
-				static_cast<GDNativeVariantType>(par.type), // GDNativeVariantType type;
-				par.name._native_ptr(), // GDNativeStringNamePtr name;
-				par.class_name._native_ptr(), // GDNativeStringNamePtr class_name;
-				par.hint, // NONE //uint32_t hint;
-				par.hint_string._native_ptr(), // GDNativeStringPtr hint_string;
-				par.usage, // DEFAULT //uint32_t usage;
-		});
+	RegistrationBatch *batch = get_registration_batch(cl.name);
+	if (batch) {
+		batch->entries.push_back({ RegistrationBatch::SIGNAL, (uint32_t)batch->signals.size() });
+		batch->signals.push_back(p_signal);
+		return;
 	}
 
-	internal::gdn_interface->classdb_register_extension_class_signal(internal::library, cl.name._native_ptr(), p_signal.name._native_ptr(), parameters.data(), parameters.size());
+	submit_signal(cl.name, p_signal);
 }
 
 void ClassDB::bind_integer_constant(const StringName &p_class_name, const StringName &p_enum_name, const StringName &p_constant_name, GDNativeInt p_constant_value, bool p_is_bitfield) {
-	std::unordered_map<StringName, ClassInfo>::iterator type_it = classes.find(p_class_name);
+	ClassInfo *type_ptr = classes.getptr(p_class_name);
 
-	ERR_FAIL_COND_MSG(type_it == classes.end(), String("Class '{0}' doesn't exist.").format(Array::make(p_class_name)));
+	ERR_FAIL_COND_MSG(!type_ptr, String("Class '{0}' doesn't exist.").format(Array::make(p_class_name)));
 
-	ClassInfo &type = type_it->second;
+	ClassInfo &type = *type_ptr;
 
 	// check if it already exists
-	ERR_FAIL_COND_MSG(type.constant_names.find(p_constant_name) != type.constant_names.end(), String("Constant '{0}::{1}' already registered.").format(Array::make(p_class_name, p_constant_name)));
+	ERR_FAIL_COND_MSG(type.constant_names.has(p_constant_name), String("Constant '{0}::{1}' already registered.").format(Array::make(p_class_name, p_constant_name)));
 
 	// register it with our plugin (purely to check for duplicates)
 	type.constant_names.insert(p_constant_name);
 
 	// Register it with Godot
+	RegistrationBatch *batch = get_registration_batch(type.name);
+	if (batch) {
+		batch->entries.push_back({ RegistrationBatch::INTEGER_CONSTANT, (uint32_t)batch->constants.size() });
+		batch->constants.push_back({ p_enum_name, p_constant_name, p_constant_value, p_is_bitfield });
+		return;
+	}
+
 	internal::gdn_interface->classdb_register_extension_class_integer_constant(internal::library, p_class_name._native_ptr(), p_enum_name._native_ptr(), p_constant_name._native_ptr(), p_constant_value, p_is_bitfield);
 }
 GDNativeExtensionClassCallVirtual ClassDB::get_virtual_func(void *p_userdata, GDNativeConstStringNamePtr p_name) {
 	// This is called by Godot the first time it calls a virtual function, and it caches the result, per object instance.
 	// Because of this, it can happen from different threads at once.
 	// It should be ok not using any mutex as long as we only READ data.
-	const StringName *class_name = reinterpret_cast<const StringName *>(p_userdata);
+	// The table already holds the methods of the parent classes (Godot classes not included).
+	const ClassInfo *type = reinterpret_cast<const ClassInfo *>(p_userdata);
 	const StringName *name = reinterpret_cast<const StringName *>(p_name);
 
-	std::unordered_map<StringName, ClassInfo>::iterator type_it = classes.find(*class_name);
-	ERR_FAIL_COND_V_MSG(type_it == classes.end(), nullptr, String("Class '{0}' doesn't exist.").format(Array::make(*class_name)));
+	return type->virtual_table.find(*name);
+}
 
-	const ClassInfo *type = &type_it->second;
+void ClassDB::bind_virtual_method(const StringName &p_class, const StringName &p_method, GDNativeExtensionClassCallVirtual p_call) {
+	ClassInfo *type_ptr = classes.getptr(p_class);
+	ERR_FAIL_COND_MSG(!type_ptr, String("Class '{0}' doesn't exist.").format(Array::make(p_class)));
 
-	// Find method in current class, or any of its parent classes (Godot classes not included)
-	while (type != nullptr) {
-		std::unordered_map<StringName, GDNativeExtensionClassCallVirtual>::const_iterator method_it = type->virtual_methods.find(*name);
+	ClassInfo &type = *type_ptr;
 
-		if (method_it != type->virtual_methods.end()) {
-			return method_it->second;
-		}
+	ERR_FAIL_COND_MSG(type.method_map.has(p_method), String("Method '{0}::{1}()' already registered as non-virtual.").format(Array::make(p_class, p_method)));
+	ERR_FAIL_COND_MSG(type.virtual_methods.has(p_method), String("Virtual '{0}::{1}()' method already registered.").format(Array::make(p_class, p_method)));
 
-		type = type->parent_ptr;
-	}
+	type.virtual_methods[p_method] = p_call;
+}
 
-	return nullptr;
+void ClassDB::set_notification_filter(const StringName &p_class, const std::vector<int32_t> &p_notifications) {
+	ClassInfo *type = classes.getptr(p_class);
+	ERR_FAIL_COND_MSG(!type, String("Class '{0}' doesn't exist.").format(Array::make(p_class)));
+
+	std::vector<int32_t> &filter = type->notification_dispatch.filter;
+	filter = p_notifications;
+	std::sort(filter.begin(), filter.end());
+	filter.erase(std::unique(filter.begin(), filter.end()), filter.end());
 }
 
-void ClassDB::bind_virtual_method(const StringName &p_class, const StringName &p_method, GDNativeExtensionClassCallVirtual p_call) {
-	std::unordered_map<StringName, ClassInfo>::iterator type_it = classes.find(p_class);
-	ERR_FAIL_COND_MSG(type_it == classes.end(), String("Class '{0}' doesn't exist.").format(Array::make(p_class)));
+void ClassDB::_begin_registration(const StringName &p_class) {
+	registration_batches.emplace_back();
+	RegistrationBatch &batch = registration_batches.back();
+	batch.class_name = p_class;
+	batch.start = std::chrono::steady_clock::now();
+}
 
-	ClassInfo &type = type_it->second;
+void ClassDB::initialize_class(ClassInfo &p_cl) {
+	// All virtuals are bound by now, and so are the ones of the parent classes.
+	p_cl.virtual_table.build(p_cl.virtual_methods, p_cl.parent_ptr ? &p_cl.parent_ptr->virtual_table : nullptr);
 
-	ERR_FAIL_COND_MSG(type.method_map.find(p_method) != type.method_map.end(), String("Method '{0}::{1}()' already registered as non-virtual.").format(Array::make(p_class, p_method)));
-	ERR_FAIL_COND_MSG(type.virtual_methods.find(p_method) != type.virtual_methods.end(), String("Virtual '{0}::{1}()' method already registered.").format(Array::make(p_class, p_method)));
+	ERR_FAIL_COND(registration_batches.empty() || !internal::StringNameDataComparator::compare(registration_batches.back().class_name, p_cl.name));
+	const RegistrationBatch &batch = registration_batches.back();
+	batch.submit();
+	p_cl.registration_usec = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - batch.start).count();
+	registration_batches.pop_back();
+}
 
-	type.virtual_methods[p_method] = p_call;
+uint64_t ClassDB::get_registration_time_usec(const StringName &p_class) {
+	const ClassInfo *type = classes.getptr(p_class);
+	ERR_FAIL_COND_V_MSG(!type, 0, String("Class '{0}' not found.").format(Array::make(p_class)));
+	return type->registration_usec;
+}
+
+void ClassDB::VirtualTable::_insert(const void *p_name, GDNativeExtensionClassCallVirtual p_call) {
+	uint32_t i = hash_one_uint64((uint64_t)(uintptr_t)p_name) & mask;
+	while (slots[i].name != nullptr) {
+		if (slots[i].name == p_name) {
+			// Overridden in a derived class, which was inserted first.
+			return;
+		}
+		i = (i + 1) & mask;
+	}
+	slots[i].name = p_name;
+	slots[i].call = p_call;
+}
+
+void ClassDB::VirtualTable::build(const NameMap<GDNativeExtensionClassCallVirtual> &p_own, const VirtualTable *p_inherited) {
+	size_t count = p_own.size();
+	if (p_inherited) {
+		for (const Slot &E : p_inherited->slots) {
+			count += E.name != nullptr ? 1 : 0;
+		}
+	}
+
+	slots.clear();
+	mask = 0;
+	if (count == 0) {
+		return;
+	}
+
+	// Keep the load factor at or below one half, so misses end quickly too.
+	uint32_t capacity = Math::next_power_of_2((uint32_t)count * 2);
+	slots.resize(capacity);
+	mask = capacity - 1;
+
+	for (const NameMap<GDNativeExtensionClassCallVirtual>::Entry &E : p_own) {
+		_insert(internal::_string_name_data(E.key), E.value);
+	}
+	if (p_inherited) {
+		for (const Slot &E : p_inherited->slots) {
+			if (E.name != nullptr) {
+				_insert(E.name, E.call);
+			}
+		}
+	}
 }
 
-void ClassDB::initialize_class(const ClassInfo &p_cl) {
+GDNativeExtensionClassCallVirtual ClassDB::VirtualTable::find(const StringName &p_name) const {
+	if (slots.empty()) {
+		return nullptr;
+	}
+
+	const void *name = internal::_string_name_data(p_name);
+	uint32_t i = hash_one_uint64((uint64_t)(uintptr_t)name) & mask;
+	while (slots[i].name != nullptr) {
+		if (slots[i].name == name) {
+			return slots[i].call;
+		}
+		i = (i + 1) & mask;
+	}
+	return nullptr;
 }
 
 void ClassDB::initialize(GDNativeInitializationLevel p_level) {
-	for (const std::pair<StringName, ClassInfo> pair : classes) {
-		const ClassInfo &cl = pair.second;
+	for (const NameMap<ClassInfo>::Entry &E : classes) {
+		const ClassInfo &cl = E.value;
 		if (cl.level != p_level) {
 			continue;
 		}
@@ -341,17 +569,25 @@ void ClassDB::initialize(GDNativeInitializationLevel p_level) {
 }
 
 void ClassDB::deinitialize(GDNativeInitializationLevel p_level) {
-	for (const std::pair<StringName, ClassInfo> pair : classes) {
-		const ClassInfo &cl = pair.second;
+	for (const NameMap<ClassInfo>::Entry &E : classes) {
+		const ClassInfo &cl = E.value;
 		if (cl.level != p_level) {
 			continue;
 		}
 
 		internal::gdn_interface->classdb_unregister_extension_class(internal::library, cl.name._native_ptr());
 
-		for (auto method : cl.method_map) {
-			memdelete(method.second);
+		for (const NameMap<MethodBind *>::Entry &method : cl.method_map) {
+			memdelete(method.value);
 		}
+
+		if (cl.instance_pool) {
+			cl.instance_pool->reset();
+		}
+	}
+
+	if (p_level == GDNATIVE_INITIALIZATION_CORE) {
+		method_registration_scratch.release();
 	}
 }
 
@@ -0,0 +1,75 @@
+/*************************************************************************/
+/*  instance_binding_cache.cpp                                           */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include <godot_cpp/core/instance_binding_cache.hpp>
+
+namespace godot {
+
+namespace internal {
+
+thread_local InstanceBindingCache::Entry InstanceBindingCache::entries[InstanceBindingCache::CACHE_SIZE];
+std::atomic<uint32_t> InstanceBindingCache::generations[InstanceBindingCache::GENERATION_BUCKETS] = {};
+
+#ifdef DEBUG_ENABLED
+std::atomic<uint64_t> InstanceBindingCache::hits{ 0 };
+std::atomic<uint64_t> InstanceBindingCache::misses{ 0 };
+std::atomic<uint64_t> InstanceBindingCache::wrapper_allocations{ 0 };
+std::atomic<uint64_t> InstanceBindingCache::invalidations{ 0 };
+#endif
+
+void InstanceBindingCache::clear() {
+	for (uint32_t i = 0; i < GENERATION_BUCKETS; i++) {
+		generations[i].fetch_add(1, std::memory_order_release);
+	}
+}
+
+InstanceBindingCache::Stats InstanceBindingCache::get_stats() {
+	Stats stats;
+#ifdef DEBUG_ENABLED
+	stats.hits = hits.load(std::memory_order_relaxed);
+	stats.misses = misses.load(std::memory_order_relaxed);
+	stats.wrapper_allocations = wrapper_allocations.load(std::memory_order_relaxed);
+	stats.invalidations = invalidations.load(std::memory_order_relaxed);
+#endif
+	return stats;
+}
+
+void InstanceBindingCache::reset_stats() {
+#ifdef DEBUG_ENABLED
+	hits.store(0, std::memory_order_relaxed);
+	misses.store(0, std::memory_order_relaxed);
+	wrapper_allocations.store(0, std::memory_order_relaxed);
+	invalidations.store(0, std::memory_order_relaxed);
+#endif
+}
+
+} // namespace internal
+
+} // namespace godot
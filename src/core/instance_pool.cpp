@@ -0,0 +1,201 @@
+/*************************************************************************/
+/*  instance_pool.cpp                                                    */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include <godot_cpp/core/instance_pool.hpp>
+
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/memory.hpp>
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/variant.hpp>
+
+namespace godot {
+
+void InstancePool::setup(size_t p_element_size, size_t p_alignment, uint32_t p_initial_slab_capacity) {
+	ERR_FAIL_COND_MSG(is_enabled(), "Instance pool is already set up.");
+	ERR_FAIL_COND(p_initial_slab_capacity == 0);
+
+	// Freed slots hold the free list link, and every slot keeps the alignment of the class.
+	size_t size = MAX(p_element_size, sizeof(void *));
+	size_t alignment = MAX(p_alignment, alignof(void *));
+	uint32_t new_element_size = (uint32_t)((size + alignment - 1) / alignment * alignment);
+
+	spin_lock.lock();
+	if (element_size != 0 && element_size != new_element_size) {
+		spin_lock.unlock();
+		ERR_FAIL_MSG("Instance pool still holds instances of a different size.");
+	}
+	// Set up again before the instances from before reset() are gone, their slabs are simply reused.
+	if (element_size == 0) {
+		element_size = new_element_size;
+		next_slab_capacity = p_initial_slab_capacity;
+	}
+	enabled.store(true);
+	spin_lock.unlock();
+}
+
+void *InstancePool::alloc() {
+	spin_lock.lock();
+	if (unlikely(!is_enabled())) {
+		spin_lock.unlock();
+		ERR_FAIL_V_MSG(nullptr, "Instance pool was reset.");
+	}
+
+	void *ptr = free_list;
+	if (ptr) {
+		free_list = *reinterpret_cast<void **>(ptr);
+	} else {
+		if (slabs.empty() || slab_used == slabs.back().capacity) {
+			Slab slab;
+			slab.capacity = next_slab_capacity;
+			slab.memory = reinterpret_cast<uint8_t *>(Memory::alloc_static((size_t)element_size * slab.capacity));
+			if (unlikely(slab.memory == nullptr)) {
+				spin_lock.unlock();
+				ERR_FAIL_V_MSG(nullptr, "Out of memory allocating instance pool slab.");
+			}
+			slabs.push_back(slab);
+			has_slabs.store(true);
+			capacity += slab.capacity;
+			next_slab_capacity *= 2;
+			slab_used = 0;
+		}
+		ptr = slabs.back().memory + (size_t)slab_used * element_size;
+		slab_used++;
+	}
+
+	used_count++;
+	peak_used_count = MAX(peak_used_count, used_count);
+	total_allocations++;
+
+	spin_lock.unlock();
+	return ptr;
+}
+
+bool InstancePool::_owns(const void *p_ptr) const {
+	const uint8_t *ptr = reinterpret_cast<const uint8_t *>(p_ptr);
+	// Newest slabs are the largest, look there first.
+	for (size_t i = slabs.size(); i > 0; i--) {
+		const Slab &slab = slabs[i - 1];
+		if (ptr >= slab.memory && ptr < slab.memory + (size_t)element_size * slab.capacity) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool InstancePool::free(void *p_ptr) {
+	spin_lock.lock();
+	if (!_owns(p_ptr)) {
+		spin_lock.unlock();
+		return false;
+	}
+
+	*reinterpret_cast<void **>(p_ptr) = free_list;
+	free_list = p_ptr;
+	used_count--;
+	if (used_count == 0 && !is_enabled()) {
+		// The last instance that outlived reset().
+		_release_slabs();
+	}
+
+	spin_lock.unlock();
+	return true;
+}
+
+bool InstancePool::owns(const void *p_ptr) const {
+	spin_lock.lock();
+	bool owned = _owns(p_ptr);
+	spin_lock.unlock();
+	return owned;
+}
+
+void InstancePool::_release_slabs() {
+	for (const Slab &slab : slabs) {
+		Memory::free_static(slab.memory);
+	}
+	slabs.clear();
+	has_slabs.store(false);
+	free_list = nullptr;
+	element_size = 0;
+	next_slab_capacity = 0;
+	slab_used = 0;
+	capacity = 0;
+}
+
+void InstancePool::reset() {
+	spin_lock.lock();
+	enabled.store(false);
+	uint32_t alive = used_count;
+	if (alive == 0) {
+		_release_slabs();
+	}
+	spin_lock.unlock();
+
+	if (alive != 0) {
+		WARN_PRINT(String("Instance pool reset with {0} instances still alive, its memory is released when the last one is freed.").format(Array::make((int64_t)alive)));
+	}
+}
+
+uint32_t InstancePool::get_used_count() const {
+	spin_lock.lock();
+	uint32_t count = used_count;
+	spin_lock.unlock();
+	return count;
+}
+
+uint32_t InstancePool::get_capacity() const {
+	spin_lock.lock();
+	uint32_t count = capacity;
+	spin_lock.unlock();
+	return count;
+}
+
+uint32_t InstancePool::get_peak_used_count() const {
+	spin_lock.lock();
+	uint32_t count = peak_used_count;
+	spin_lock.unlock();
+	return count;
+}
+
+uint32_t InstancePool::get_slab_count() const {
+	spin_lock.lock();
+	uint32_t count = (uint32_t)slabs.size();
+	spin_lock.unlock();
+	return count;
+}
+
+uint64_t InstancePool::get_total_allocations() const {
+	spin_lock.lock();
+	uint64_t count = total_allocations;
+	spin_lock.unlock();
+	return count;
+}
+
+} // namespace godot
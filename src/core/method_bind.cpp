@@ -60,8 +60,8 @@ void MethodBind::set_vararg(bool p_vararg) {
 	_vararg = p_vararg;
 }
 
-void MethodBind::set_argument_names(const std::vector<StringName> &p_names) {
-	argument_names = p_names;
+void MethodBind::set_argument_names(std::vector<StringName> p_names) {
+	argument_names = std::move(p_names);
 }
 
 std::vector<StringName> MethodBind::get_argument_names() const {
@@ -0,0 +1,73 @@
+/*************************************************************************/
+/*  typed_signal.cpp                                                     */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include <godot_cpp/core/typed_signal.hpp>
+
+#include <godot_cpp/templates/spin_lock.hpp>
+
+#include <new>
+
+namespace godot {
+
+namespace internal {
+
+static SpinLock typed_signal_lock;
+static TypedSignalBase *typed_signals = nullptr;
+
+void TypedSignalBase::_bind(const StringName &p_class, const MethodInfo &p_info) {
+	// The same handle may be bound to several classes, the name only has to be packed once.
+	typed_signal_lock.lock();
+	if (name_variant == nullptr) {
+		name_variant = new (name_variant_storage) Variant(get_name());
+		next = typed_signals;
+		typed_signals = this;
+	}
+	typed_signal_lock.unlock();
+
+	ClassDB::add_signal(p_class, p_info);
+}
+
+void TypedSignalBase::clear() {
+	typed_signal_lock.lock();
+	TypedSignalBase *signal = typed_signals;
+	while (signal) {
+		TypedSignalBase *next_signal = signal->next;
+		const_cast<Variant *>(signal->name_variant)->~Variant();
+		signal->name_variant = nullptr;
+		signal->next = nullptr;
+		signal = next_signal;
+	}
+	typed_signals = nullptr;
+	typed_signal_lock.unlock();
+}
+
+} // namespace internal
+
+} // namespace godot
@@ -32,7 +32,10 @@
 
 #include <godot_cpp/classes/wrapped.hpp>
 #include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/instance_binding_cache.hpp>
 #include <godot_cpp/core/memory.hpp>
+#include <godot_cpp/core/typed_signal.hpp>
+#include <godot_cpp/variant/sname.hpp>
 #include <godot_cpp/variant/variant.hpp>
 
 #include <godot_cpp/core/error_macros.hpp>
@@ -85,6 +88,13 @@ void GDExtensionBinding::deinitialize_level(void *userdata, GDNativeInitializati
 	}
 
 	ClassDB::deinitialize(p_level);
+	internal::InstanceBindingCache::clear();
+
+	if (p_level == GDNATIVE_INITIALIZATION_CORE) {
+		// Last level, release interned names while the engine can still free them.
+		internal::TypedSignalBase::clear();
+		internal::SNameSlot::clear();
+	}
 }
 
 void GDExtensionBinding::InitObject::register_initializer(Callback p_init) const {
@@ -32,122 +32,103 @@
 
 #include <godot_cpp/core/memory.hpp>
 #include <godot_cpp/variant/node_path.hpp>
+#include <godot_cpp/variant/number_format.hpp>
 #include <godot_cpp/variant/string.hpp>
 #include <godot_cpp/variant/string_name.hpp>
 
 #include <godot_cpp/godot.hpp>
 
 #include <cmath>
+#include <cstring>
+#include <type_traits>
 
 namespace godot {
 
-int CharString::length() const {
+template <class T>
+int CharStringT<T>::length() const {
 	return _length;
 }
 
-const char *CharString::get_data() const {
+template <class T>
+const T *CharStringT<T>::get_data() const {
 	return _data;
 }
 
-CharString::CharString(CharString &&p_str) {
-	SWAP(_length, p_str._length);
-	SWAP(_data, p_str._data);
-}
-
-void CharString::operator=(CharString &&p_str) {
-	SWAP(_length, p_str._length);
-	SWAP(_data, p_str._data);
-}
-
-CharString::CharString(const char *str, int length) :
-		_data(str), _length(length) {}
-
-CharString::~CharString() {
-	if (_data != nullptr) {
-		memdelete_arr(_data);
-	}
-}
-
-int Char16String::length() const {
-	return _length;
-}
-
-const char16_t *Char16String::get_data() const {
+template <class T>
+T *CharStringT<T>::_alloc(int p_length) {
+	_free();
+	_data = p_length <= INLINE_CAPACITY ? _inline : memnew_arr(T, p_length);
+	_length = p_length;
 	return _data;
 }
 
-Char16String::Char16String(Char16String &&p_str) {
-	SWAP(_length, p_str._length);
-	SWAP(_data, p_str._data);
-}
-
-void Char16String::operator=(Char16String &&p_str) {
-	SWAP(_length, p_str._length);
-	SWAP(_data, p_str._data);
-}
-
-Char16String::Char16String(const char16_t *str, int length) :
-		_data(str), _length(length) {}
-
-Char16String::~Char16String() {
-	if (_data != nullptr) {
+template <class T>
+void CharStringT<T>::_free() {
+	if (_data != nullptr && _data != _inline) {
 		memdelete_arr(_data);
 	}
+	_data = nullptr;
+	_length = 0;
 }
 
-int Char32String::length() const {
-	return _length;
+template <class T>
+void CharStringT<T>::_copy_from(const CharStringT &p_str) {
+	if (p_str._data == nullptr) {
+		_free();
+		return;
+	}
+	memcpy(_alloc(p_str._length), p_str._data, p_str._length * sizeof(T));
 }
 
-const char32_t *Char32String::get_data() const {
-	return _data;
+template <class T>
+void CharStringT<T>::_move_from(CharStringT &p_str) {
+	if (p_str.is_inline()) {
+		_copy_from(p_str);
+		p_str._free();
+		return;
+	}
+	_free();
+	_data = p_str._data;
+	_length = p_str._length;
+	p_str._data = nullptr;
+	p_str._length = 0;
 }
 
-Char32String::Char32String(Char32String &&p_str) {
-	SWAP(_length, p_str._length);
-	SWAP(_data, p_str._data);
+template <class T>
+CharStringT<T>::CharStringT(const CharStringT &p_str) {
+	_copy_from(p_str);
 }
 
-void Char32String::operator=(Char32String &&p_str) {
-	SWAP(_length, p_str._length);
-	SWAP(_data, p_str._data);
+template <class T>
+CharStringT<T>::CharStringT(CharStringT &&p_str) {
+	_move_from(p_str);
 }
 
-Char32String::Char32String(const char32_t *str, int length) :
-		_data(str), _length(length) {}
-
-Char32String::~Char32String() {
-	if (_data != nullptr) {
-		memdelete_arr(_data);
+template <class T>
+CharStringT<T> &CharStringT<T>::operator=(const CharStringT &p_str) {
+	if (this != &p_str) {
+		_copy_from(p_str);
 	}
+	return *this;
 }
 
-int CharWideString::length() const {
-	return _length;
-}
-
-const wchar_t *CharWideString::get_data() const {
-	return _data;
-}
-
-CharWideString::CharWideString(CharWideString &&p_str) {
-	SWAP(_length, p_str._length);
-	SWAP(_data, p_str._data);
+template <class T>
+CharStringT<T> &CharStringT<T>::operator=(CharStringT &&p_str) {
+	if (this != &p_str) {
+		_move_from(p_str);
+	}
+	return *this;
 }
 
-void CharWideString::operator=(CharWideString &&p_str) {
-	SWAP(_length, p_str._length);
-	SWAP(_data, p_str._data);
+template <class T>
+CharStringT<T>::~CharStringT() {
+	_free();
 }
 
-CharWideString::CharWideString(const wchar_t *str, int length) :
-		_data(str), _length(length) {}
-
-CharWideString::~CharWideString() {
-	if (_data != nullptr) {
-		memdelete_arr(_data);
-	}
-}
+template class CharStringT<char>;
+template class CharStringT<char16_t>;
+template class CharStringT<char32_t>;
+template class CharStringT<wchar_t>;
 
 // Custom String functions that are not part of bound API.
 // It's easier to have them written in C++ directly than in a Python script that generates them.
@@ -188,13 +169,23 @@ void String::parse_utf16(const char16_t *from, int len) {
 	internal::gdn_interface->string_new_with_utf16_chars_and_len(_native_ptr(), from, len);
 }
 
+// Numbers are formatted and parsed locally (see number_format.hpp), with the same results as the engine.
+static _FORCE_INLINE_ String _ascii_string(const char *p_chars, int p_length) {
+	String ret;
+	internal::gdn_interface->string_new_with_latin1_chars_and_len(ret._native_ptr(), p_chars, p_length);
+	return ret;
+}
+
 String String::num_real(double p_num, bool p_trailing) {
+	char buf[internal::REAL_FORMAT_MAX_LENGTH + 2];
+	int length;
 	if (p_num == (double)(int64_t)p_num) {
+		length = internal::format_int((int64_t)p_num, buf);
 		if (p_trailing) {
-			return num_int64((int64_t)p_num) + ".0";
-		} else {
-			return num_int64((int64_t)p_num);
+			buf[length++] = '.';
+			buf[length++] = '0';
 		}
+		return _ascii_string(buf, length);
 	}
 #ifdef REAL_T_IS_DOUBLE
 	int decimals = 14;
@@ -206,73 +197,277 @@ String String::num_real(double p_num, bool p_trailing) {
 	if (p_num > 10) {
 		decimals -= (int)floor(log10(p_num));
 	}
-	return num(p_num, decimals);
+	length = internal::format_real(p_num, decimals, buf);
+	return _ascii_string(buf, length);
+}
+
+int64_t String::to_int(const char *p_str, int p_len) {
+	return internal::parse_int(p_str, p_len);
+}
+
+int64_t String::to_int(const char32_t *p_str, int p_len, bool p_clamp) {
+	return internal::parse_int(p_str, p_len, p_clamp);
+}
+
+double String::to_float(const char *p_str) {
+	return internal::parse_float(p_str);
+}
+
+double String::to_float(const char32_t *p_str) {
+	return internal::parse_float(p_str);
 }
 
 String itos(int64_t p_val) {
-	return String::num_int64(p_val);
+	char buf[internal::INT_FORMAT_MAX_LENGTH];
+	return _ascii_string(buf, internal::format_int(p_val, buf));
 }
 
 String uitos(uint64_t p_val) {
-	return String::num_uint64(p_val);
+	char buf[internal::INT_FORMAT_MAX_LENGTH];
+	return _ascii_string(buf, internal::format_uint(p_val, buf));
 }
 
 String rtos(double p_val) {
-	return String::num(p_val);
+	char buf[internal::REAL_FORMAT_MAX_LENGTH];
+	return _ascii_string(buf, internal::format_real(p_val, -1, buf));
 }
 
 String rtoss(double p_val) {
-	return String::num_scientific(p_val);
+	char buf[internal::REAL_FORMAT_MAX_LENGTH];
+	return _ascii_string(buf, internal::format_real_scientific(p_val, buf));
+}
+
+// Transcoding works on the UTF-32 characters of the String, read once through ptr(), instead of asking the
+// engine to convert twice (once for the size and once for the data). Invalid code points are encoded the
+// same way the engine does.
+
+// Code points are copied while a whole block of them is ASCII, a loop compilers turn into vector code.
+static constexpr int64_t ASCII_BLOCK_SIZE = 16;
+
+template <class T>
+static _FORCE_INLINE_ bool _narrow_ascii_block(const char32_t *p_src, T *r_dst) {
+	char32_t bits = 0;
+	for (int64_t i = 0; i < ASCII_BLOCK_SIZE; i++) {
+		bits |= p_src[i];
+	}
+	if (bits >= 0x80) {
+		return false;
+	}
+	for (int64_t i = 0; i < ASCII_BLOCK_SIZE; i++) {
+		r_dst[i] = T(p_src[i]);
+	}
+	return true;
+}
+
+// Returns the number of bytes written, or -1 if they don't fit in p_capacity.
+static int64_t _encode_utf8(const char32_t *p_src, int64_t p_length, char *r_dst, int64_t p_capacity) {
+	char *dst = r_dst;
+	char *end = r_dst + p_capacity;
+	int64_t i = 0;
+	while (i < p_length) {
+		while (i + ASCII_BLOCK_SIZE <= p_length && dst + ASCII_BLOCK_SIZE <= end && _narrow_ascii_block(p_src + i, dst)) {
+			i += ASCII_BLOCK_SIZE;
+			dst += ASCII_BLOCK_SIZE;
+		}
+		if (i == p_length) {
+			break;
+		}
+
+		char32_t c = p_src[i++];
+		if (c > 0x10FFFF) {
+			c = 0xFFFD; // Replacement character.
+		}
+		if (c < 0x80) {
+			if (dst + 1 > end) {
+				return -1;
+			}
+			*dst++ = char(c);
+		} else if (c < 0x800) {
+			if (dst + 2 > end) {
+				return -1;
+			}
+			*dst++ = char(0xC0 | (c >> 6));
+			*dst++ = char(0x80 | (c & 0x3F));
+		} else if (c < 0x10000) {
+			if (dst + 3 > end) {
+				return -1;
+			}
+			*dst++ = char(0xE0 | (c >> 12));
+			*dst++ = char(0x80 | ((c >> 6) & 0x3F));
+			*dst++ = char(0x80 | (c & 0x3F));
+		} else {
+			if (dst + 4 > end) {
+				return -1;
+			}
+			*dst++ = char(0xF0 | (c >> 18));
+			*dst++ = char(0x80 | ((c >> 12) & 0x3F));
+			*dst++ = char(0x80 | ((c >> 6) & 0x3F));
+			*dst++ = char(0x80 | (c & 0x3F));
+		}
+	}
+	return dst - r_dst;
+}
+
+// Returns the number of units written, or -1 if they don't fit in p_capacity.
+static int64_t _encode_utf16(const char32_t *p_src, int64_t p_length, char16_t *r_dst, int64_t p_capacity) {
+	char16_t *dst = r_dst;
+	char16_t *end = r_dst + p_capacity;
+	int64_t i = 0;
+	while (i < p_length) {
+		while (i + ASCII_BLOCK_SIZE <= p_length && dst + ASCII_BLOCK_SIZE <= end && _narrow_ascii_block(p_src + i, dst)) {
+			i += ASCII_BLOCK_SIZE;
+			dst += ASCII_BLOCK_SIZE;
+		}
+		if (i == p_length) {
+			break;
+		}
+
+		char32_t c = p_src[i++];
+		if (c > 0x10FFFF) {
+			c = 0xFFFD; // Replacement character.
+		}
+		if (c < 0x10000) {
+			if (dst + 1 > end) {
+				return -1;
+			}
+			*dst++ = char16_t(c);
+		} else {
+			if (dst + 2 > end) {
+				return -1;
+			}
+			c -= 0x10000;
+			*dst++ = char16_t(0xD800 | (c >> 10));
+			*dst++ = char16_t(0xDC00 | (c & 0x3FF));
+		}
+	}
+	return dst - r_dst;
+}
+
+// Exact sizes of the encodings, so the result can be written straight into its final allocation.
+static int64_t _utf8_size(const char32_t *p_src, int64_t p_length) {
+	int64_t size = 0;
+	for (int64_t i = 0; i < p_length; i++) {
+		char32_t c = p_src[i];
+		if (c < 0x80) {
+			size += 1;
+		} else if (c < 0x800) {
+			size += 2;
+		} else if (c < 0x10000 || c > 0x10FFFF) {
+			size += 3; // Invalid code points become the three byte replacement character.
+		} else {
+			size += 4;
+		}
+	}
+	return size;
+}
+
+static int64_t _utf16_size(const char32_t *p_src, int64_t p_length) {
+	int64_t size = p_length;
+	for (int64_t i = 0; i < p_length; i++) {
+		size += (p_src[i] >= 0x10000 && p_src[i] <= 0x10FFFF) ? 1 : 0;
+	}
+	return size;
+}
+
+// Writes the null terminated UTF-8 encoding into a buffer owned by the caller, and returns its length without the
+// terminator, or -1 if p_capacity (which counts the terminator) is too small. Nothing is allocated, so code that
+// converts many Strings should keep one buffer and reuse it. length() * 4 + 1 bytes always fit, and
+// length() * 2 + 1 units for utf16_into().
+int64_t String::utf8_into(char *r_buffer, int64_t p_capacity) const {
+	ERR_FAIL_COND_V(p_capacity < 1, -1);
+	int64_t length = this->length();
+	int64_t size = length == 0 ? 0 : _encode_utf8(ptr(), length, r_buffer, p_capacity - 1);
+	if (size >= 0) {
+		r_buffer[size] = '\0';
+	}
+	return size;
+}
+
+int64_t String::utf16_into(char16_t *r_buffer, int64_t p_capacity) const {
+	ERR_FAIL_COND_V(p_capacity < 1, -1);
+	int64_t length = this->length();
+	int64_t size = length == 0 ? 0 : _encode_utf16(ptr(), length, r_buffer, p_capacity - 1);
+	if (size >= 0) {
+		r_buffer[size] = 0;
+	}
+	return size;
 }
 
 CharString String::utf8() const {
-	int size = internal::gdn_interface->string_to_utf8_chars(_native_ptr(), nullptr, 0);
-	char *cstr = memnew_arr(char, size + 1);
-	internal::gdn_interface->string_to_utf8_chars(_native_ptr(), cstr, size + 1);
+	CharString ret;
+	int64_t length = this->length();
+	int64_t size = length == 0 ? 0 : _utf8_size(ptr(), length);
+	char *cstr = ret._alloc(size + 1);
+	if (size > 0) {
+		_encode_utf8(ptr(), length, cstr, size);
+	}
 
 	cstr[size] = '\0';
 
-	return CharString(cstr, size + 1);
+	return ret;
 }
 
 CharString String::ascii() const {
-	int size = internal::gdn_interface->string_to_latin1_chars(_native_ptr(), nullptr, 0);
-	char *cstr = memnew_arr(char, size + 1);
-	internal::gdn_interface->string_to_latin1_chars(_native_ptr(), cstr, size + 1);
+	// Latin-1 has one byte per character, so the size is known up front.
+	CharString ret;
+	int64_t size = length();
+	char *cstr = ret._alloc(size + 1);
+	internal::gdn_interface->string_to_latin1_chars(_native_ptr(), cstr, size);
 
 	cstr[size] = '\0';
 
-	return CharString(cstr, size + 1);
+	return ret;
 }
 
 Char16String String::utf16() const {
-	int size = internal::gdn_interface->string_to_utf16_chars(_native_ptr(), nullptr, 0);
-	char16_t *cstr = memnew_arr(char16_t, size + 1);
-	internal::gdn_interface->string_to_utf16_chars(_native_ptr(), cstr, size + 1);
+	Char16String ret;
+	int64_t length = this->length();
+	int64_t size = length == 0 ? 0 : _utf16_size(ptr(), length);
+	char16_t *cstr = ret._alloc(size + 1);
+	if (size > 0) {
+		_encode_utf16(ptr(), length, cstr, size);
+	}
 
-	cstr[size] = '\0';
+	cstr[size] = 0;
 
-	return Char16String(cstr, size + 1);
+	return ret;
 }
 
 Char32String String::utf32() const {
-	int size = internal::gdn_interface->string_to_utf32_chars(_native_ptr(), nullptr, 0);
-	char32_t *cstr = memnew_arr(char32_t, size + 1);
-	internal::gdn_interface->string_to_utf32_chars(_native_ptr(), cstr, size + 1);
+	Char32String ret;
+	int64_t size = length();
+	char32_t *cstr = ret._alloc(size + 1);
+	if (size > 0) {
+		memcpy(cstr, ptr(), size * sizeof(char32_t));
+	}
 
 	cstr[size] = '\0';
 
-	return Char32String(cstr, size + 1);
+	return ret;
 }
 
 CharWideString String::wide_string() const {
-	int size = internal::gdn_interface->string_to_wide_chars(_native_ptr(), nullptr, 0);
-	wchar_t *cstr = memnew_arr(wchar_t, size + 1);
-	internal::gdn_interface->string_to_wide_chars(_native_ptr(), cstr, size + 1);
+	CharWideString ret;
+	int64_t size = length();
+	wchar_t *cstr = nullptr;
+	if (sizeof(wchar_t) == sizeof(char32_t)) {
+		cstr = ret._alloc(size + 1);
+		if (size > 0) {
+			memcpy(cstr, ptr(), size * sizeof(wchar_t));
+		}
+	} else {
+		// UTF-16, as on Windows.
+		int64_t length = size;
+		size = length == 0 ? 0 : _utf16_size(ptr(), length);
+		cstr = ret._alloc(size + 1);
+		if (size > 0) {
+			_encode_utf16(ptr(), length, reinterpret_cast<char16_t *>(cstr), size);
+		}
+	}
 
 	cstr[size] = '\0';
 
-	return CharWideString(cstr, size + 1);
+	return ret;
 }
 
 String &String::operator=(const char *p_str) {
@@ -295,52 +490,156 @@ String &String::operator=(const char32_t *p_str) {
 	return *this;
 }
 
+// Literals are compared with and appended to the characters of the String directly, instead of being turned
+// into a temporary String by the engine first. char literals are Latin-1, like in the String constructor.
+// UTF-16 literals holding surrogates still go through the engine, so pairs are decoded the way it does it.
+
+template <class T>
+static _FORCE_INLINE_ char32_t _literal_char(T p_unit) {
+	if constexpr (std::is_same_v<T, char>) {
+		return char32_t(uint8_t(p_unit));
+	} else {
+		return char32_t(p_unit);
+	}
+}
+
+// Measures the literal, stopping after p_limit units. Returns false if it has to be decoded by the engine.
+template <class T>
+static _FORCE_INLINE_ bool _scan_literal(const T *p_str, int64_t p_limit, int64_t &r_length) {
+	int64_t length = 0;
+	if (p_str) {
+		while (length < p_limit && p_str[length] != 0) {
+			if constexpr (sizeof(T) == 2) {
+				if ((p_str[length] & 0xF800) == 0xD800) {
+					return false;
+				}
+			}
+			length++;
+		}
+	}
+	r_length = length;
+	return true;
+}
+
+template <class T>
+static bool _equals_literal(const String &p_string, const T *p_str) {
+	int64_t length = p_string.length();
+	int64_t literal_length;
+	if (!_scan_literal(p_str, length + 1, literal_length)) {
+		return p_string == String(p_str);
+	}
+	if (literal_length != length) {
+		return false;
+	}
+	if (length == 0) {
+		return true;
+	}
+
+	const char32_t *src = p_string.ptr();
+	if constexpr (sizeof(T) == sizeof(char32_t)) {
+		return memcmp(src, p_str, length * sizeof(char32_t)) == 0;
+	} else {
+		// Differences are accumulated over whole blocks, which compilers turn into vector code.
+		int64_t i = 0;
+		for (; i + ASCII_BLOCK_SIZE <= length; i += ASCII_BLOCK_SIZE) {
+			char32_t diff = 0;
+			for (int64_t j = 0; j < ASCII_BLOCK_SIZE; j++) {
+				diff |= src[i + j] ^ _literal_char(p_str[i + j]);
+			}
+			if (diff != 0) {
+				return false;
+			}
+		}
+		for (; i < length; i++) {
+			if (src[i] != _literal_char(p_str[i])) {
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+// Short results are built on the stack.
+static constexpr int64_t CONCAT_STACK_CAPACITY = 256;
+
+// The result is built in a temporary buffer of the exact size, and handed to the engine in a single call.
+template <class T>
+static String _concat_literal(const String &p_string, const T *p_str, bool p_literal_first) {
+	int64_t literal_length;
+	if (!_scan_literal(p_str, INT64_MAX, literal_length)) {
+		return p_literal_first ? String(p_str) + p_string : p_string + String(p_str);
+	}
+	if (literal_length == 0) {
+		return p_string;
+	}
+	int64_t length = p_string.length();
+	if (length == 0) {
+		return String(p_str);
+	}
+
+	int64_t total = length + literal_length;
+	char32_t stack_buffer[CONCAT_STACK_CAPACITY];
+	char32_t *dst = total <= CONCAT_STACK_CAPACITY ? stack_buffer : (char32_t *)memalloc(total * sizeof(char32_t));
+	char32_t *literal_dst = p_literal_first ? dst : dst + length;
+	memcpy(p_literal_first ? dst + literal_length : dst, p_string.ptr(), length * sizeof(char32_t));
+	for (int64_t i = 0; i < literal_length; i++) {
+		literal_dst[i] = _literal_char(p_str[i]);
+	}
+
+	String ret;
+	internal::gdn_interface->string_new_with_utf32_chars_and_len(ret._native_ptr(), dst, total);
+	if (dst != stack_buffer) {
+		memfree(dst);
+	}
+	return ret;
+}
+
 bool String::operator==(const char *p_str) const {
-	return *this == String(p_str);
+	return _equals_literal(*this, p_str);
 }
 
 bool String::operator==(const wchar_t *p_str) const {
-	return *this == String(p_str);
+	return _equals_literal(*this, p_str);
 }
 
 bool String::operator==(const char16_t *p_str) const {
-	return *this == String(p_str);
+	return _equals_literal(*this, p_str);
 }
 
 bool String::operator==(const char32_t *p_str) const {
-	return *this == String(p_str);
+	return _equals_literal(*this, p_str);
 }
 
 bool String::operator!=(const char *p_str) const {
-	return *this != String(p_str);
+	return !_equals_literal(*this, p_str);
 }
 
 bool String::operator!=(const wchar_t *p_str) const {
-	return *this != String(p_str);
+	return !_equals_literal(*this, p_str);
 }
 
 bool String::operator!=(const char16_t *p_str) const {
-	return *this != String(p_str);
+	return !_equals_literal(*this, p_str);
 }
 
 bool String::operator!=(const char32_t *p_str) const {
-	return *this != String(p_str);
+	return !_equals_literal(*this, p_str);
 }
 
 String String::operator+(const char *p_chr) {
-	return *this + String(p_chr);
+	return _concat_literal(*this, p_chr, false);
 }
 
 String String::operator+(const wchar_t *p_chr) {
-	return *this + String(p_chr);
+	return _concat_literal(*this, p_chr, false);
 }
 
 String String::operator+(const char16_t *p_chr) {
-	return *this + String(p_chr);
+	return _concat_literal(*this, p_chr, false);
 }
 
 String String::operator+(const char32_t *p_chr) {
-	return *this + String(p_chr);
+	return _concat_literal(*this, p_chr, false);
 }
 
 const char32_t &String::operator[](int p_index) const {
@@ -360,51 +659,51 @@ char32_t *String::ptrw() {
 }
 
 bool operator==(const char *p_chr, const String &p_str) {
-	return p_str == String(p_chr);
+	return _equals_literal(p_str, p_chr);
 }
 
 bool operator==(const wchar_t *p_chr, const String &p_str) {
-	return p_str == String(p_chr);
+	return _equals_literal(p_str, p_chr);
 }
 
 bool operator==(const char16_t *p_chr, const String &p_str) {
-	return p_str == String(p_chr);
+	return _equals_literal(p_str, p_chr);
 }
 
 bool operator==(const char32_t *p_chr, const String &p_str) {
-	return p_str == String(p_chr);
+	return _equals_literal(p_str, p_chr);
 }
 
 bool operator!=(const char *p_chr, const String &p_str) {
-	return !(p_str == p_chr);
+	return !_equals_literal(p_str, p_chr);
 }
 
 bool operator!=(const wchar_t *p_chr, const String &p_str) {
-	return !(p_str == p_chr);
+	return !_equals_literal(p_str, p_chr);
 }
 
 bool operator!=(const char16_t *p_chr, const String &p_str) {
-	return !(p_str == p_chr);
+	return !_equals_literal(p_str, p_chr);
 }
 
 bool operator!=(const char32_t *p_chr, const String &p_str) {
-	return !(p_str == p_chr);
+	return !_equals_literal(p_str, p_chr);
 }
 
 String operator+(const char *p_chr, const String &p_str) {
-	return String(p_chr) + p_str;
+	return _concat_literal(p_str, p_chr, true);
 }
 
 String operator+(const wchar_t *p_chr, const String &p_str) {
-	return String(p_chr) + p_str;
+	return _concat_literal(p_str, p_chr, true);
 }
 
 String operator+(const char16_t *p_chr, const String &p_str) {
-	return String(p_chr) + p_str;
+	return _concat_literal(p_str, p_chr, true);
 }
 
 String operator+(const char32_t *p_chr, const String &p_str) {
-	return String(p_chr) + p_str;
+	return _concat_literal(p_str, p_chr, true);
 }
 
 StringName::StringName(const char *from) :
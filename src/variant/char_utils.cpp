@@ -0,0 +1,122 @@
+/*************************************************************************/
+/*  char_utils.cpp                                                       */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include <godot_cpp/variant/char_utils.hpp>
+
+namespace godot {
+
+// Characters are tested a whole block at a time, with branchless versions of the predicates that compilers
+// turn into vector code. The block holding the first match is then scanned one character at a time.
+static constexpr int64_t SCAN_BLOCK_SIZE = 16;
+
+static _FORCE_INLINE_ uint32_t _whitespace_bit(char32_t c) {
+	return uint32_t(c == ' ') | uint32_t(c == 0x00a0) | uint32_t(c == 0x1680) | uint32_t(c - 0x2000 <= 0x200a - 0x2000) | uint32_t(c == 0x202f) | uint32_t(c == 0x205f) | uint32_t(c == 0x3000) | uint32_t(c == 0x2028) | uint32_t(c == 0x2029) | uint32_t(c - 0x0009 <= 0x000d - 0x0009) | uint32_t(c == 0x0085);
+}
+
+static _FORCE_INLINE_ uint32_t _linebreak_bit(char32_t c) {
+	return uint32_t(c - 0x000a <= 0x000d - 0x000a) | uint32_t(c == 0x0085) | uint32_t(c == 0x2028) | uint32_t(c == 0x2029);
+}
+
+static _FORCE_INLINE_ uint32_t _identifier_bit(char32_t c) {
+	return uint32_t(c - 'a' <= 'z' - 'a') | uint32_t(c - 'A' <= 'Z' - 'A') | uint32_t(c - '0' <= '9' - '0') | uint32_t(c == '_');
+}
+
+int64_t find_first_non_whitespace(const char32_t *p_str, int64_t p_length) {
+	int64_t i = 0;
+	for (; i + SCAN_BLOCK_SIZE <= p_length; i += SCAN_BLOCK_SIZE) {
+		uint32_t all = 1;
+		for (int64_t j = 0; j < SCAN_BLOCK_SIZE; j++) {
+			all &= _whitespace_bit(p_str[i + j]);
+		}
+		if (!all) {
+			break;
+		}
+	}
+	for (; i < p_length; i++) {
+		if (!is_whitespace(p_str[i])) {
+			return i;
+		}
+	}
+	return p_length;
+}
+
+int64_t find_first_of(const char32_t *p_str, int64_t p_length, const char32_t *p_set, int64_t p_set_length) {
+	int64_t i = 0;
+	for (; i + SCAN_BLOCK_SIZE <= p_length; i += SCAN_BLOCK_SIZE) {
+		uint32_t any = 0;
+		for (int64_t k = 0; k < p_set_length; k++) {
+			char32_t s = p_set[k];
+			for (int64_t j = 0; j < SCAN_BLOCK_SIZE; j++) {
+				any |= uint32_t(p_str[i + j] == s);
+			}
+		}
+		if (any) {
+			break;
+		}
+	}
+	for (; i < p_length; i++) {
+		for (int64_t k = 0; k < p_set_length; k++) {
+			if (p_str[i] == p_set[k]) {
+				return i;
+			}
+		}
+	}
+	return p_length;
+}
+
+int64_t count_linebreaks(const char32_t *p_str, int64_t p_length) {
+	int64_t count = 0;
+	for (int64_t i = 0; i < p_length; i++) {
+		count += _linebreak_bit(p_str[i]);
+	}
+	return count;
+}
+
+bool is_valid_identifier(const char32_t *p_str, int64_t p_length) {
+	if (p_length <= 0 || is_digit(p_str[0])) {
+		return false;
+	}
+	uint32_t all = 1;
+	int64_t i = 0;
+	for (; i + SCAN_BLOCK_SIZE <= p_length; i += SCAN_BLOCK_SIZE) {
+		for (int64_t j = 0; j < SCAN_BLOCK_SIZE; j++) {
+			all &= _identifier_bit(p_str[i + j]);
+		}
+		if (!all) {
+			return false;
+		}
+	}
+	for (; i < p_length; i++) {
+		all &= _identifier_bit(p_str[i]);
+	}
+	return all != 0;
+}
+
+} // namespace godot
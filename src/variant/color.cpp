@@ -31,8 +31,13 @@
 #include <godot_cpp/core/error_macros.hpp>
 #include <godot_cpp/variant/color.hpp>
 #include <godot_cpp/variant/color_names.inc.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
+#include <godot_cpp/variant/packed_color_array.hpp>
+#include <godot_cpp/variant/packed_string_array.hpp>
 #include <godot_cpp/variant/string.hpp>
 
+#include <cstring>
+
 namespace godot {
 
 uint32_t Color::to_argb32() const {
@@ -107,37 +112,34 @@ uint64_t Color::to_rgba64() const {
 	return c;
 }
 
-String _to_hex(float p_val) {
-	int v = Math::round(p_val * 255.0f);
-	v = CLAMP(v, 0, 255);
-	String ret;
+static _FORCE_INLINE_ uint8_t _to_byte(float p_val) {
+	return (uint8_t)CLAMP(Math::round(p_val * 255.0f), 0.0f, 255.0f);
+}
 
-	for (int i = 0; i < 2; i++) {
-		char32_t c[2] = { 0, 0 };
-		int lv = v & 0xF;
-		if (lv < 10) {
-			c[0] = '0' + lv;
-		} else {
-			c[0] = 'a' + lv - 10;
-		}
+static _FORCE_INLINE_ char *_write_hex(char *r_dst, float p_val) {
+	static const char digits[] = "0123456789abcdef";
+	uint8_t v = _to_byte(p_val);
+	*r_dst++ = digits[v >> 4];
+	*r_dst++ = digits[v & 0xF];
+	return r_dst;
+}
 
-		v >>= 4;
-		String cs = (const char32_t *)c;
-		ret = cs + ret;
+int Color::to_html_chars(char *r_buffer, bool p_alpha) const {
+	char *dst = r_buffer;
+	dst = _write_hex(dst, r);
+	dst = _write_hex(dst, g);
+	dst = _write_hex(dst, b);
+	if (p_alpha) {
+		dst = _write_hex(dst, a);
 	}
-
-	return ret;
+	*dst = '\0';
+	return int(dst - r_buffer);
 }
 
 String Color::to_html(bool p_alpha) const {
-	String txt;
-	txt = txt + _to_hex(r);
-	txt = txt + _to_hex(g);
-	txt = txt + _to_hex(b);
-	if (p_alpha) {
-		txt = txt + _to_hex(a);
-	}
-	return txt;
+	char txt[9];
+	to_html_chars(txt, p_alpha);
+	return String(txt);
 }
 
 float Color::get_h() const {
@@ -282,103 +284,125 @@ Color Color::hex64(uint64_t p_hex) {
 	return Color(r, g, b, a);
 }
 
-static int _parse_col4(const String &p_str, int p_ofs) {
-	char character = p_str[p_ofs];
-
-	if (character >= '0' && character <= '9') {
-		return character - '0';
-	} else if (character >= 'a' && character <= 'f') {
-		return character + (10 - 'a');
-	} else if (character >= 'A' && character <= 'F') {
-		return character + (10 - 'A');
+template <class C>
+static _FORCE_INLINE_ int _parse_col4(C p_character) {
+	if (p_character >= '0' && p_character <= '9') {
+		return p_character - '0';
+	} else if (p_character >= 'a' && p_character <= 'f') {
+		return p_character + (10 - 'a');
+	} else if (p_character >= 'A' && p_character <= 'F') {
+		return p_character + (10 - 'A');
 	}
 	return -1;
 }
 
-static int _parse_col8(const String &p_str, int p_ofs) {
-	return _parse_col4(p_str, p_ofs) * 16 + _parse_col4(p_str, p_ofs + 1);
-}
-
-Color Color::inverted() const {
-	Color c = *this;
-	c.invert();
-	return c;
-}
-
-Color Color::html(const String &p_rgba) {
-	String color = p_rgba;
-	if (color.length() == 0) {
-		return Color();
-	}
-	if (color[0] == '#') {
-		color = color.substr(1);
+template <class C>
+static bool _html_parse(const C *p_rgba, int64_t p_length, Color &r_color) {
+	if (p_length > 0 && p_rgba[0] == '#') {
+		p_rgba++;
+		p_length--;
 	}
 
 	// If enabled, use 1 hex digit per channel instead of 2.
 	// Other sizes aren't in the HTML/CSS spec but we could add them if desired.
-	bool is_shorthand = color.length() < 5;
-	bool alpha = false;
-
-	if (color.length() == 8) {
-		alpha = true;
-	} else if (color.length() == 6) {
-		alpha = false;
-	} else if (color.length() == 4) {
-		alpha = true;
-	} else if (color.length() == 3) {
-		alpha = false;
-	} else {
-		ERR_FAIL_V_MSG(Color(), "Invalid color code: " + p_rgba + ".");
+	if (!(p_length == 3 || p_length == 4 || p_length == 6 || p_length == 8)) {
+		return false;
 	}
+	bool is_shorthand = p_length < 5;
+	bool alpha = p_length == 4 || p_length == 8;
 
-	float r, g, b, a = 1.0f;
+	int digits[8];
+	for (int i = 0; i < p_length; i++) {
+		digits[i] = _parse_col4(p_rgba[i]);
+		if (digits[i] < 0) {
+			return false;
+		}
+	}
+
+	float a = 1.0f;
 	if (is_shorthand) {
-		r = _parse_col4(color, 0) / 15.0f;
-		g = _parse_col4(color, 1) / 15.0f;
-		b = _parse_col4(color, 2) / 15.0f;
 		if (alpha) {
-			a = _parse_col4(color, 3) / 15.0f;
+			a = digits[3] / 15.0f;
 		}
+		r_color = Color(digits[0] / 15.0f, digits[1] / 15.0f, digits[2] / 15.0f, a);
 	} else {
-		r = _parse_col8(color, 0) / 255.0f;
-		g = _parse_col8(color, 2) / 255.0f;
-		b = _parse_col8(color, 4) / 255.0f;
 		if (alpha) {
-			a = _parse_col8(color, 6) / 255.0f;
+			a = (digits[6] * 16 + digits[7]) / 255.0f;
 		}
+		r_color = Color((digits[0] * 16 + digits[1]) / 255.0f, (digits[2] * 16 + digits[3]) / 255.0f, (digits[4] * 16 + digits[5]) / 255.0f, a);
 	}
-	ERR_FAIL_COND_V_MSG(r < 0.0f, Color(), "Invalid color code: " + p_rgba + ".");
-	ERR_FAIL_COND_V_MSG(g < 0.0f, Color(), "Invalid color code: " + p_rgba + ".");
-	ERR_FAIL_COND_V_MSG(b < 0.0f, Color(), "Invalid color code: " + p_rgba + ".");
-	ERR_FAIL_COND_V_MSG(a < 0.0f, Color(), "Invalid color code: " + p_rgba + ".");
+	return true;
+}
 
-	return Color(r, g, b, a);
+bool Color::html_parse(const char *p_rgba, int64_t p_length, Color &r_color) {
+	return _html_parse(p_rgba, p_length, r_color);
 }
 
-bool Color::html_is_valid(const String &p_color) {
-	String color = p_color;
+bool Color::html_parse(const char32_t *p_rgba, int64_t p_length, Color &r_color) {
+	return _html_parse(p_rgba, p_length, r_color);
+}
 
-	if (color.length() == 0) {
-		return false;
-	}
-	if (color[0] == '#') {
-		color = color.substr(1);
+Color Color::inverted() const {
+	Color c = *this;
+	c.invert();
+	return c;
+}
+
+Color Color::html(const String &p_rgba) {
+	int64_t length = p_rgba.length();
+	if (length == 0) {
+		return Color();
 	}
 
-	// Check if the amount of hex digits is valid.
-	int len = color.length();
-	if (!(len == 3 || len == 4 || len == 6 || len == 8)) {
+	Color color;
+	ERR_FAIL_COND_V_MSG(!html_parse(p_rgba.ptr(), length, color), Color(), "Invalid color code: " + p_rgba + ".");
+	return color;
+}
+
+bool Color::html_is_valid(const String &p_color) {
+	int64_t length = p_color.length();
+	if (length == 0) {
 		return false;
 	}
 
-	// Check if each hex digit is valid.
-	for (int i = 0; i < len; i++) {
-		if (_parse_col4(color, i) == -1) {
-			return false;
+	Color color;
+	return html_parse(p_color.ptr(), length, color);
+}
+
+PackedColorArray Color::html_batch(const PackedStringArray &p_codes, const Color &p_default) {
+	PackedColorArray colors;
+	int64_t count = p_codes.size();
+	if (count == 0) {
+		return colors;
+	}
+	colors.resize(count);
+
+	const String *codes = p_codes.ptr();
+	Color *dst = colors.ptrw();
+	for (int64_t i = 0; i < count; i++) {
+		int64_t length = codes[i].length();
+		if (length == 0 || !html_parse(codes[i].ptr(), length, dst[i])) {
+			dst[i] = p_default;
 		}
 	}
+	return colors;
+}
 
-	return true;
+PackedByteArray Color::to_rgba8_batch(const PackedColorArray &p_colors) {
+	PackedByteArray bytes;
+	int64_t count = p_colors.size();
+	if (count == 0) {
+		return bytes;
+	}
+	bytes.resize(count * 4);
+
+	// Colors are four packed floats, so this is one flat loop the compiler can vectorize.
+	const float *src = p_colors.ptr()->components;
+	uint8_t *dst = bytes.ptrw();
+	for (int64_t i = 0; i < count * 4; i++) {
+		dst[i] = _to_byte(src[i]);
+	}
+	return bytes;
 }
 
 Color Color::named(const String &p_name) {
@@ -398,33 +422,103 @@ Color Color::named(const String &p_name, const Color &p_default) {
 	return named_colors[idx].color;
 }
 
-int Color::find_named_color(const String &p_name) {
-	String name = p_name;
-	// Normalize name
-	name = name.replace(" ", "");
-	name = name.replace("-", "");
-	name = name.replace("_", "");
-	name = name.replace("'", "");
-	name = name.replace(".", "");
-	name = name.to_upper();
-
-	int idx = 0;
-	while (named_colors[idx].name != nullptr) {
-		if (name == String(named_colors[idx].name).replace("_", "")) {
-			return idx;
+// Named colors are found through an open addressing table over their normalized names, which are the
+// names without underscores. It is built once, and lookups normalize into a stack buffer, so they don't
+// allocate and only call into the engine to read the string.
+class NamedColorTable {
+	static constexpr int MAX_LENGTH = 32;
+	static constexpr int MAX_COUNT = sizeof(named_colors) / sizeof(NamedColor) - 1;
+	static constexpr uint32_t SLOT_COUNT = 512; // Power of two, keeps probe sequences short.
+
+	int count = 0;
+	char normalized[MAX_COUNT][MAX_LENGTH] = {};
+	int16_t slots[SLOT_COUNT];
+
+	static uint32_t _hash(const char *p_name) {
+		// FNV-1a.
+		uint32_t hash = 0x811C9DC5;
+		while (*p_name) {
+			hash = (hash ^ uint8_t(*p_name++)) * 0x01000193;
 		}
-		idx++;
+		return hash;
 	}
 
-	return -1;
+public:
+	NamedColorTable() {
+		for (uint32_t i = 0; i < SLOT_COUNT; i++) {
+			slots[i] = -1;
+		}
+
+		while (named_colors[count].name != nullptr) {
+			char *dst = normalized[count];
+			for (const char *src = named_colors[count].name; *src; src++) {
+				if (*src != '_') {
+					*dst++ = *src;
+				}
+			}
+
+			uint32_t i = _hash(normalized[count]) & (SLOT_COUNT - 1);
+			while (slots[i] != -1) {
+				i = (i + 1) & (SLOT_COUNT - 1);
+			}
+			slots[i] = count;
+			count++;
+		}
+	}
+
+	_FORCE_INLINE_ int get_count() const { return count; }
+
+	int find(const String &p_name) const {
+		int64_t length = p_name.length();
+		if (length == 0) {
+			return -1;
+		}
+		const char32_t *src = p_name.ptr();
+
+		// Same normalization as the engine: drop separators and make it upper case.
+		char name[MAX_LENGTH];
+		int name_length = 0;
+		for (int64_t i = 0; i < length; i++) {
+			char32_t c = src[i];
+			if (c == ' ' || c == '-' || c == '_' || c == '\'' || c == '.') {
+				continue;
+			}
+			if (c >= 'a' && c <= 'z') {
+				c -= 'a' - 'A';
+			} else if (c == 0x0131) {
+				c = 'I'; // Dotless i.
+			} else if (c == 0x017F) {
+				c = 'S'; // Long s.
+			}
+			if (c < 'A' || c > 'Z' || name_length == MAX_LENGTH - 1) {
+				return -1; // Every color name is made of ASCII letters only.
+			}
+			name[name_length++] = char(c);
+		}
+		name[name_length] = '\0';
+
+		uint32_t i = _hash(name) & (SLOT_COUNT - 1);
+		while (slots[i] != -1) {
+			if (strcmp(normalized[slots[i]], name) == 0) {
+				return slots[i];
+			}
+			i = (i + 1) & (SLOT_COUNT - 1);
+		}
+		return -1;
+	}
+};
+
+static const NamedColorTable &get_named_color_table() {
+	static const NamedColorTable table;
+	return table;
+}
+
+int Color::find_named_color(const String &p_name) {
+	return get_named_color_table().find(p_name);
 }
 
 int Color::get_named_color_count() {
-	int idx = 0;
-	while (named_colors[idx].name != nullptr) {
-		idx++;
-	}
-	return idx;
+	return get_named_color_table().get_count();
 }
 
 String Color::get_named_color_name(int p_idx) {
@@ -0,0 +1,305 @@
+/*************************************************************************/
+/*  number_format.cpp                                                    */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include <godot_cpp/variant/number_format.hpp>
+
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/variant/char_utils.hpp>
+
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace godot {
+
+namespace internal {
+
+// Same limit as the engine.
+static constexpr int MAX_DECIMALS = 32;
+
+// Characters String::num() keeps of its printf() output, the size of its buffer minus the terminator.
+static constexpr int ENGINE_REAL_MAX_LENGTH = 255;
+
+// Doubles below this are integers exactly when they have no fractional part.
+static constexpr double MAX_EXACT_INTEGER = 9007199254740992.0;
+
+static const char DIGIT_PAIRS[] =
+		"00010203040506070809"
+		"10111213141516171819"
+		"20212223242526272829"
+		"30313233343536373839"
+		"40414243444546474849"
+		"50515253545556575859"
+		"60616263646566676869"
+		"70717273747576777879"
+		"80818283848586878889"
+		"90919293949596979899";
+
+// Digits are produced two at a time from the end, one division per pair.
+int format_uint(uint64_t p_num, char *r_buffer) {
+	char digits[20];
+	char *end = digits + sizeof(digits);
+	char *dst = end;
+	while (p_num >= 100) {
+		uint64_t pair = p_num % 100;
+		p_num /= 100;
+		dst -= 2;
+		memcpy(dst, DIGIT_PAIRS + pair * 2, 2);
+	}
+	if (p_num >= 10) {
+		dst -= 2;
+		memcpy(dst, DIGIT_PAIRS + p_num * 2, 2);
+	} else {
+		*--dst = char('0' + p_num);
+	}
+	int length = int(end - dst);
+	memcpy(r_buffer, dst, length);
+	return length;
+}
+
+int format_int(int64_t p_num, char *r_buffer) {
+	if (p_num < 0) {
+		r_buffer[0] = '-';
+		return 1 + format_uint(0 - uint64_t(p_num), r_buffer + 1);
+	}
+	return format_uint(uint64_t(p_num), r_buffer);
+}
+
+static _FORCE_INLINE_ int _format_non_finite(double p_num, char *r_buffer) {
+	const char *text = std::isnan(p_num) ? "nan" : (std::signbit(p_num) ? "-inf" : "inf");
+	int length = int(strlen(text));
+	memcpy(r_buffer, text, length);
+	return length;
+}
+
+int default_real_decimals(double p_num) {
+	int decimals = 14;
+	double abs_num = std::fabs(p_num);
+	if (abs_num > 10) {
+		// We want to align the digits to the above sane default, so we only
+		// need to subtract log10 for numbers with a positive power of ten.
+		decimals -= (int)std::floor(std::log10(abs_num));
+	}
+	return decimals;
+}
+
+// Fixed notation, exactly rounded like printf(), without trailing zeros and cut to the length the engine keeps.
+int format_real(double p_num, int p_decimals, char *r_buffer) {
+	if (!std::isfinite(p_num)) {
+		return _format_non_finite(p_num, r_buffer);
+	}
+
+	// Integers print the same whatever the number of decimals, since the zeros are stripped.
+	if (std::fabs(p_num) < MAX_EXACT_INTEGER && p_num == std::trunc(p_num)) {
+		if (p_num == 0 && std::signbit(p_num)) {
+			memcpy(r_buffer, "-0", 2);
+			return 2;
+		}
+		return format_int(int64_t(p_num), r_buffer);
+	}
+
+	if (p_decimals < 0) {
+		p_decimals = default_real_decimals(p_num);
+	}
+	if (p_decimals > MAX_DECIMALS) {
+		p_decimals = MAX_DECIMALS;
+	}
+	// The engine falls back to "%lf" when there are no digits left for decimals.
+	int precision = p_decimals < 0 ? 6 : p_decimals;
+
+	int length;
+#ifdef __cpp_lib_to_chars
+	std::to_chars_result result = std::to_chars(r_buffer, r_buffer + REAL_FORMAT_MAX_LENGTH, p_num, std::chars_format::fixed, precision);
+	ERR_FAIL_COND_V(result.ec != std::errc(), 0);
+	length = int(result.ptr - r_buffer);
+#else
+	char buf[REAL_FORMAT_MAX_LENGTH + 1];
+	length = snprintf(buf, sizeof(buf), "%.*f", precision, p_num);
+	ERR_FAIL_COND_V(length < 0 || length > REAL_FORMAT_MAX_LENGTH, 0);
+	memcpy(r_buffer, buf, length);
+#endif
+
+	// The engine prints into a 256 byte buffer and keeps what fits, so only huge numbers (around 1e255 and above)
+	// are cut, and their period usually with them. Zeros are stripped from what is left, as it does.
+	if (length > ENGINE_REAL_MAX_LENGTH) {
+		length = ENGINE_REAL_MAX_LENGTH;
+	}
+
+	if (memchr(r_buffer, '.', length)) {
+		while (r_buffer[length - 1] == '0') {
+			length--;
+		}
+		if (r_buffer[length - 1] == '.') {
+			length--;
+		}
+	}
+	return length;
+}
+
+// Same as printf() with "%lg".
+int format_real_scientific(double p_num, char *r_buffer) {
+	if (!std::isfinite(p_num)) {
+		return _format_non_finite(p_num, r_buffer);
+	}
+
+#ifdef __cpp_lib_to_chars
+	std::to_chars_result result = std::to_chars(r_buffer, r_buffer + REAL_FORMAT_MAX_LENGTH, p_num, std::chars_format::general, 6);
+	ERR_FAIL_COND_V(result.ec != std::errc(), 0);
+	return int(result.ptr - r_buffer);
+#else
+	char buf[REAL_FORMAT_MAX_LENGTH + 1];
+	int length = snprintf(buf, sizeof(buf), "%lg", p_num);
+	ERR_FAIL_COND_V(length < 0 || length > REAL_FORMAT_MAX_LENGTH, 0);
+	memcpy(r_buffer, buf, length);
+	return length;
+#endif
+}
+
+// Accumulates one more digit, returning false on overflow.
+static _FORCE_INLINE_ bool _accumulate_digit(uint64_t &r_magnitude, uint64_t p_limit, char32_t p_digit) {
+	uint64_t digit = p_digit - '0';
+	if (r_magnitude > (p_limit - digit) / 10) {
+		return false;
+	}
+	r_magnitude = r_magnitude * 10 + digit;
+	return true;
+}
+
+static _FORCE_INLINE_ uint64_t _int_limit(bool p_negative) {
+	return p_negative ? uint64_t(INT64_MAX) + 1 : uint64_t(INT64_MAX);
+}
+
+static _FORCE_INLINE_ int64_t _apply_sign(uint64_t p_magnitude, bool p_negative) {
+	return p_negative ? int64_t(0 - p_magnitude) : int64_t(p_magnitude);
+}
+
+// Spaces are skipped, a '-' before any digit flips the sign, and reading stops at the first '.' or other
+// character.
+int64_t parse_int(const char *p_str, int p_len) {
+	int to = 0;
+	if (p_len >= 0) {
+		to = p_len;
+	} else {
+		while (p_str[to] != 0 && p_str[to] != '.') {
+			to++;
+		}
+	}
+
+	uint64_t magnitude = 0;
+	bool negative = false;
+	for (int i = 0; i < to; i++) {
+		char c = p_str[i];
+		if (is_digit(c)) {
+			if (!_accumulate_digit(magnitude, _int_limit(negative), c)) {
+				ERR_FAIL_V_MSG(negative ? INT64_MIN : INT64_MAX, "Cannot represent the number as a 64-bit signed integer.");
+			}
+		} else if (c == '-' && magnitude == 0) {
+			negative = !negative;
+		} else if (c != ' ') {
+			break;
+		}
+	}
+	return _apply_sign(magnitude, negative);
+}
+
+// Characters before the first sign or digit are skipped, and reading stops at the first character that is
+// not a digit after them.
+int64_t parse_int(const char32_t *p_str, int p_len, bool p_clamp) {
+	const char32_t *str = p_str;
+	const char32_t *limit = p_len >= 0 ? p_str + p_len : nullptr;
+	while (str != limit && *str != 0 && !is_digit(*str) && *str != '-' && *str != '+') {
+		str++;
+	}
+	bool negative = false;
+	if (str != limit && (*str == '-' || *str == '+')) {
+		negative = *str == '-';
+		str++;
+	}
+
+	uint64_t magnitude = 0;
+	for (; str != limit && is_digit(*str); str++) {
+		if (!_accumulate_digit(magnitude, _int_limit(negative), *str)) {
+			if (p_clamp) {
+				return negative ? INT64_MIN : INT64_MAX;
+			}
+			ERR_FAIL_V_MSG(negative ? INT64_MIN : INT64_MAX, "Cannot represent the number as a 64-bit signed integer.");
+		}
+	}
+	return _apply_sign(magnitude, negative);
+}
+
+// Leading whitespace and one sign are accepted, then the longest valid decimal number is read. Like the
+// engine, hexadecimal, "inf" and "nan" are not numbers, and invalid input gives 0.
+double parse_float(const char *p_str) {
+	const char *str = p_str;
+	while (*str == ' ' || (*str >= '\t' && *str <= '\r')) {
+		str++;
+	}
+	bool negative = *str == '-';
+	if (*str == '-' || *str == '+') {
+		str++;
+	}
+	if (!is_digit(*str) && *str != '.') {
+		return 0;
+	}
+
+	double value = 0;
+#ifdef __cpp_lib_to_chars
+	std::from_chars_result result = std::from_chars(str, str + strlen(str), value, std::chars_format::general);
+	if (result.ec == std::errc::result_out_of_range) {
+		// Overflows to infinity and underflows to zero, as in the engine.
+		value = strtod(str, nullptr);
+	}
+#else
+	// strtod() would also read hexadecimal, of which the engine only sees the leading zero.
+	if (str[0] != '0' || (str[1] != 'x' && str[1] != 'X')) {
+		value = strtod(str, nullptr);
+	}
+#endif
+	return negative ? -value : value;
+}
+
+double parse_float(const char32_t *p_str) {
+	// Numbers are ASCII, so only that prefix (as much as fits) is narrowed.
+	char buf[1024];
+	int length = 0;
+	while (length < int(sizeof(buf)) - 1 && p_str[length] != 0 && p_str[length] < 0x80) {
+		buf[length] = char(p_str[length]);
+		length++;
+	}
+	buf[length] = '\0';
+	return parse_float(buf);
+}
+
+} // namespace internal
+
+} // namespace godot
@@ -0,0 +1,73 @@
+/*************************************************************************/
+/*  sname.cpp                                                            */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include <godot_cpp/variant/sname.hpp>
+
+#include <godot_cpp/templates/spin_lock.hpp>
+
+#include <new>
+
+namespace godot {
+
+namespace internal {
+
+static SpinLock sname_lock;
+static SNameSlot *sname_slots = nullptr;
+
+StringName *SNameSlot::_intern() {
+	sname_lock.lock();
+	StringName *sname = value.load(std::memory_order_relaxed);
+	if (sname == nullptr) {
+		sname = new (storage) StringName(name);
+		next = sname_slots;
+		sname_slots = this;
+		value.store(sname, std::memory_order_release);
+	}
+	sname_lock.unlock();
+	return sname;
+}
+
+void SNameSlot::clear() {
+	sname_lock.lock();
+	SNameSlot *slot = sname_slots;
+	while (slot) {
+		SNameSlot *next_slot = slot->next;
+		slot->value.load(std::memory_order_relaxed)->~StringName();
+		slot->value.store(nullptr, std::memory_order_release);
+		slot->next = nullptr;
+		slot = next_slot;
+	}
+	sname_slots = nullptr;
+	sname_lock.unlock();
+}
+
+} // namespace internal
+
+} // namespace godot
@@ -0,0 +1,244 @@
+/*************************************************************************/
+/*  string_builder.cpp                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include <godot_cpp/variant/string_builder.hpp>
+
+#include <godot_cpp/core/memory.hpp>
+#include <godot_cpp/variant/number_format.hpp>
+
+#include <godot_cpp/godot.hpp>
+
+#include <cstring>
+#include <utility>
+
+namespace godot {
+
+void StringBuilder::_grow(int64_t p_min_capacity) {
+	int64_t new_capacity = capacity < 64 ? 64 : capacity * 2;
+	while (new_capacity < p_min_capacity) {
+		new_capacity *= 2;
+	}
+	buffer = (char32_t *)memrealloc(buffer, new_capacity * sizeof(char32_t));
+	capacity = new_capacity;
+}
+
+StringBuilder &StringBuilder::append(const String &p_string) {
+	int64_t string_length = p_string.length();
+	if (string_length > 0) {
+		memcpy(_reserve_tail(string_length), p_string.ptr(), string_length * sizeof(char32_t));
+		length += string_length;
+	}
+	appended++;
+	return *this;
+}
+
+StringBuilder &StringBuilder::append(const char *p_cstring) {
+	int64_t string_length = p_cstring ? strlen(p_cstring) : 0;
+	char32_t *dst = _reserve_tail(string_length);
+	for (int64_t i = 0; i < string_length; i++) {
+		dst[i] = char32_t(uint8_t(p_cstring[i]));
+	}
+	length += string_length;
+	appended++;
+	return *this;
+}
+
+StringBuilder &StringBuilder::append(const char32_t *p_cstring) {
+	appended++;
+	if (p_cstring == nullptr) {
+		return *this;
+	}
+	int64_t string_length = 0;
+	while (p_cstring[string_length] != 0) {
+		string_length++;
+	}
+	if (string_length > 0) {
+		memcpy(_reserve_tail(string_length), p_cstring, string_length * sizeof(char32_t));
+		length += string_length;
+	}
+	return *this;
+}
+
+StringBuilder &StringBuilder::append(char32_t p_char) {
+	*_reserve_tail(1) = p_char;
+	length++;
+	appended++;
+	return *this;
+}
+
+// Valid UTF-8 is decoded here. Anything else is left to the engine, so that errors are reported and
+// replaced the same way as in String::utf8().
+StringBuilder &StringBuilder::append_utf8(const char *p_utf8, int64_t p_length) {
+	if (p_length < 0) {
+		p_length = p_utf8 ? strlen(p_utf8) : 0;
+	}
+	const uint8_t *src = (const uint8_t *)p_utf8;
+	char32_t *dst = _reserve_tail(p_length);
+	int64_t count = 0;
+	int64_t i = 0;
+	while (i < p_length) {
+		uint8_t c = src[i];
+		if (c < 0x80) {
+			dst[count++] = c;
+			i++;
+			continue;
+		}
+
+		int64_t size;
+		char32_t code;
+		char32_t min_code;
+		if ((c & 0xE0) == 0xC0) {
+			size = 2;
+			code = c & 0x1F;
+			min_code = 0x80;
+		} else if ((c & 0xF0) == 0xE0) {
+			size = 3;
+			code = c & 0x0F;
+			min_code = 0x800;
+		} else if ((c & 0xF8) == 0xF0) {
+			size = 4;
+			code = c & 0x07;
+			min_code = 0x10000;
+		} else {
+			break;
+		}
+		if (i + size > p_length) {
+			break;
+		}
+		int64_t j = 1;
+		for (; j < size && (src[i + j] & 0xC0) == 0x80; j++) {
+			code = (code << 6) | (src[i + j] & 0x3F);
+		}
+		if (j < size || code < min_code || code > 0x10FFFF || (code >= 0xD800 && code <= 0xDFFF)) {
+			break;
+		}
+		dst[count++] = code;
+		i += size;
+	}
+
+	if (i < p_length) {
+		return append(String::utf8(p_utf8, p_length));
+	}
+	length += count;
+	appended++;
+	return *this;
+}
+
+void StringBuilder::_append_ascii(const char *p_chars, int p_length) {
+	char32_t *dst = _reserve_tail(p_length);
+	for (int i = 0; i < p_length; i++) {
+		dst[i] = char32_t(p_chars[i]);
+	}
+	length += p_length;
+	appended++;
+}
+
+StringBuilder &StringBuilder::append_int(int64_t p_num) {
+	char buf[internal::INT_FORMAT_MAX_LENGTH];
+	_append_ascii(buf, internal::format_int(p_num, buf));
+	return *this;
+}
+
+StringBuilder &StringBuilder::append_uint(uint64_t p_num) {
+	char buf[internal::INT_FORMAT_MAX_LENGTH];
+	_append_ascii(buf, internal::format_uint(p_num, buf));
+	return *this;
+}
+
+StringBuilder &StringBuilder::append_real(double p_num, int p_decimals) {
+	char buf[internal::REAL_FORMAT_MAX_LENGTH];
+	_append_ascii(buf, internal::format_real(p_num, p_decimals, buf));
+	return *this;
+}
+
+void StringBuilder::reserve(int64_t p_length) {
+	if (p_length > capacity) {
+		buffer = (char32_t *)memrealloc(buffer, p_length * sizeof(char32_t));
+		capacity = p_length;
+	}
+}
+
+void StringBuilder::clear() {
+	length = 0;
+	appended = 0;
+}
+
+String StringBuilder::as_string() const {
+	String ret;
+	if (length > 0) {
+		internal::gdn_interface->string_new_with_utf32_chars_and_len(ret._native_ptr(), buffer, length);
+	}
+	return ret;
+}
+
+StringBuilder::StringBuilder(const StringBuilder &p_other) {
+	*this = p_other;
+}
+
+StringBuilder::StringBuilder(StringBuilder &&p_other) {
+	*this = std::move(p_other);
+}
+
+StringBuilder &StringBuilder::operator=(const StringBuilder &p_other) {
+	if (this != &p_other) {
+		length = 0;
+		if (p_other.length > 0) {
+			memcpy(_reserve_tail(p_other.length), p_other.buffer, p_other.length * sizeof(char32_t));
+		}
+		length = p_other.length;
+		appended = p_other.appended;
+	}
+	return *this;
+}
+
+StringBuilder &StringBuilder::operator=(StringBuilder &&p_other) {
+	if (this != &p_other) {
+		if (buffer) {
+			memfree(buffer);
+		}
+		buffer = p_other.buffer;
+		length = p_other.length;
+		capacity = p_other.capacity;
+		appended = p_other.appended;
+		p_other.buffer = nullptr;
+		p_other.length = 0;
+		p_other.capacity = 0;
+		p_other.appended = 0;
+	}
+	return *this;
+}
+
+StringBuilder::~StringBuilder() {
+	if (buffer) {
+		memfree(buffer);
+	}
+}
+
+} // namespace godot
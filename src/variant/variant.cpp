@@ -34,6 +34,7 @@
 
 #include <godot_cpp/core/binder_common.hpp>
 #include <godot_cpp/core/defs.hpp>
+#include <godot_cpp/core/instance_binding_cache.hpp>
 
 #include <utility>
 
@@ -407,7 +408,7 @@ Variant::operator Object *() const {
 	if (obj == nullptr) {
 		return nullptr;
 	}
-	return reinterpret_cast<Object *>(internal::gdn_interface->object_get_instance_binding(obj, internal::token, &Object::___binding_callbacks));
+	return reinterpret_cast<Object *>(internal::InstanceBindingCache::get(obj, &Object::___binding_callbacks));
 }
 
 Variant::operator Callable() const {
@@ -50,6 +50,109 @@ func _ready():
 	var array: Array[int] = [1, 2, 3]
 	$Example.test_tarray_arg(array)
 
+	prints("Method batch")
+	prints("  visibility and material [true, false, true, false, true, true, true, true, true, false, true, false, true, true, true, true]", $Example.test_method_batch())
+
+	prints("Number formatting")
+	prints("  round trip failures (0)", $Example.test_number_round_trip())
+
+	prints("Case mapping")
+	prints("  failures (0)", $Example.test_case_mapping())
+
+	prints("Character scanning")
+	prints("  failures (0)", $Example.test_char_scanning())
+
+	prints("Rope")
+	var benchmark = $Example.test_rope_benchmark()
+	prints("  matches string (true)", benchmark["matches"])
+	prints("  edit usec, rope", benchmark["rope_edit_usec"], "string", benchmark["string_edit_usec"])
+	prints("  line lookup usec, rope", benchmark["rope_line_usec"], "string", benchmark["string_line_usec"])
+
+	prints("Class name")
+	var class_name_benchmark = $Example.test_class_name_benchmark()
+	prints("  casts (1000000)", class_name_benchmark["casts"])
+	prints("  nsec, get_class_static", class_name_benchmark["get_class_static_nsec"], "guarded static", class_name_benchmark["guarded_static_nsec"], "cast_to", class_name_benchmark["cast_to_nsec"])
+
+	prints("Builtin calls")
+	var builtin_call_benchmark = $Example.test_builtin_call_benchmark()
+	prints("  total (10100000)", builtin_call_benchmark["total"])
+	prints("  String nsec, length", builtin_call_benchmark["string_length_nsec"], "substr", builtin_call_benchmark["string_substr_nsec"], "assigned", builtin_call_benchmark["string_substr_assigned_nsec"])
+	prints("  Array nsec, size", builtin_call_benchmark["array_size_nsec"], "duplicate", builtin_call_benchmark["array_duplicate_nsec"], "assigned", builtin_call_benchmark["array_duplicate_assigned_nsec"])
+
+	prints("Method batch benchmark")
+	var method_batch_benchmark = $Example.test_method_batch_benchmark()
+	prints("  visible count (100000)", method_batch_benchmark["visible_count"])
+	prints("  set_visible nsec, loop", method_batch_benchmark["loop_set_nsec"], "batch", method_batch_benchmark["batch_set_nsec"])
+	prints("  is_visible nsec, loop", method_batch_benchmark["loop_get_nsec"], "batch", method_batch_benchmark["batch_get_nsec"])
+
+	prints("SNAME")
+	var sname_benchmark = $Example.test_sname_benchmark()
+	prints("  total (400000)", sname_benchmark["total"])
+	prints("  name nsec, literal", sname_benchmark["literal_name_nsec"], "SNAME", sname_benchmark["sname_name_nsec"])
+	prints("  call nsec, literal", sname_benchmark["literal_call_nsec"], "SNAME", sname_benchmark["sname_call_nsec"])
+	prints("  emit_signal nsec, literal", sname_benchmark["literal_emit_nsec"], "SNAME", sname_benchmark["sname_emit_nsec"])
+
+	prints("Instantiation")
+	var instantiation_benchmark = $Example.test_instantiation_benchmark()
+	prints("  spawned (true)", instantiation_benchmark["spawned"])
+	prints("  usec per node, instantiate", instantiation_benchmark["instantiate_usec"], "spawn into the tree", instantiation_benchmark["spawn_usec"])
+
+	prints("Ref returns")
+	var ref_return_benchmark = $Example.test_ref_return_benchmark()
+	prints("  total (300000)", ref_return_benchmark["total"])
+	prints("  refcount unchanged (true)", ref_return_benchmark["refcount_unchanged"])
+	prints("  nsec per call, int return", ref_return_benchmark["plain_nsec"], "Ref return", ref_return_benchmark["ref_return_nsec"], "through Variant", ref_return_benchmark["variant_return_nsec"])
+
+	prints("Instance binding cache")
+	var binding_cache_benchmark = $Example.test_binding_cache_benchmark()
+	prints("  total (960000)", binding_cache_benchmark["total"])
+	prints("  get_child hit rate", binding_cache_benchmark["hit_rate"], "wrapper allocations (0)", binding_cache_benchmark["wrapper_allocations"])
+	prints("  nsec, get_child", binding_cache_benchmark["get_child_nsec"], "cached lookup", binding_cache_benchmark["cached_lookup_nsec"], "engine lookup", binding_cache_benchmark["engine_lookup_nsec"])
+
+	prints("Binding 5000 methods")
+	var bind_benchmark = $Example.test_bind_benchmark()
+	prints("  bound (true)", bind_benchmark["bound"])
+	prints("  usec, bind_method() calls", bind_benchmark["bind_usec"], "whole registration", bind_benchmark["registration_usec"])
+	prints("  nsec per method", bind_benchmark["per_method_nsec"])
+
+	prints("Class registration")
+	var registration_benchmark = $Example.test_registration_benchmark()
+	prints("  classes (6)", registration_benchmark["classes"])
+	for class_name in registration_benchmark["per_class_usec"]:
+		prints("  usec,", class_name, registration_benchmark["per_class_usec"][class_name])
+	prints("  usec, all classes", registration_benchmark["total_usec"])
+
+	prints("Notification dispatch")
+	var notification_benchmark = $Example.test_notification_benchmark()
+	prints("  received (200000)", notification_benchmark["received"])
+	prints("  nsec per notification, base class", notification_benchmark["shallow_nsec"], "5 levels deep", notification_benchmark["deep_nsec"], "filtered out", notification_benchmark["filtered_nsec"])
+
+	prints("UTF-8 transcoding")
+	var transcoding_benchmark = $Example.test_transcoding_benchmark()
+	prints("  same output (true)", transcoding_benchmark["matches"])
+	for text in ["ascii", "mixed"]:
+		prints("  nsec,", text, "two passes", transcoding_benchmark[text + "_two_pass_nsec"], "utf8()", transcoding_benchmark[text + "_utf8_nsec"], "utf8_into()", transcoding_benchmark[text + "_utf8_into_nsec"])
+
+	prints("Short CharStrings")
+	var char_string_benchmark = $Example.test_char_string_benchmark()
+	prints("  total (7220000)", char_string_benchmark["total"])
+	prints("  all inline (true)", char_string_benchmark["inline"])
+	prints("  nsec per name, utf8()", char_string_benchmark["convert_nsec"], "into a heap buffer", char_string_benchmark["heap_nsec"], "copy", char_string_benchmark["copy_nsec"])
+
+	prints("String literals")
+	var literal_benchmark = $Example.test_literal_benchmark()
+	prints("  total (5000000)", literal_benchmark["total"])
+	prints("  nsec per ==/!=, temporary String", literal_benchmark["compare_temporary_nsec"], "literal", literal_benchmark["compare_literal_nsec"])
+	prints("  nsec per +, temporary String", literal_benchmark["concat_temporary_nsec"], "literal", literal_benchmark["concat_literal_nsec"])
+
+	prints("Case conversion benchmark (nsec per character)")
+	var case_benchmark = $Example.test_case_benchmark()
+	prints("  mismatches (0)", case_benchmark["mismatches"])
+	prints("  ASCII per character", case_benchmark["ascii_loop_nsec"])
+	prints("  ASCII to_upper_case", case_benchmark["ascii_span_nsec"])
+	prints("  mixed per character", case_benchmark["mixed_loop_nsec"])
+	prints("  mixed to_upper_case", case_benchmark["mixed_span_nsec"])
+
 	prints("Properties")
 	prints("  custom position is", $Example.group_subgroup_custom_position)
 	$Example.group_subgroup_custom_position = Vector2(50, 50)
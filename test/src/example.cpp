@@ -7,10 +7,20 @@
 
 #include <godot_cpp/core/class_db.hpp>
 
+#include <godot_cpp/classes/canvas_item_material.hpp>
 #include <godot_cpp/classes/global_constants.hpp>
 #include <godot_cpp/classes/label.hpp>
+#include <godot_cpp/templates/rope.hpp>
+#include <godot_cpp/variant/char_utils.hpp>
+#include <godot_cpp/variant/string_builder.hpp>
+#include <godot_cpp/variant/ucaps.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
 using namespace godot;
 
 ExampleRef::ExampleRef() {
@@ -44,10 +54,6 @@ bool Example::_set(const StringName &p_name, const Variant &p_value) {
 		dprop[index] = p_value;
 		return true;
 	}
-	if (name == "property_from_list") {
-		property_from_list = p_value;
-		return true;
-	}
 	return false;
 }
 
@@ -58,15 +64,11 @@ bool Example::_get(const StringName &p_name, Variant &r_ret) const {
 		r_ret = dprop[index];
 		return true;
 	}
-	if (name == "property_from_list") {
-		r_ret = property_from_list;
-		return true;
-	}
 	return false;
 }
 
 String Example::_to_string() const {
-	return "[ GDExtension::Example <--> Instance ID:" + uitos(get_instance_id()) + " ]";
+	return StringBuilder().append("[ GDExtension::Example <--> Instance ID:").append_uint(get_instance_id()).append(" ]");
 }
 
 void Example::_get_property_list(List<PropertyInfo> *p_list) const {
@@ -77,7 +79,7 @@ void Example::_get_property_list(List<PropertyInfo> *p_list) const {
 }
 
 bool Example::_property_can_revert(const StringName &p_name) const {
-	if (p_name == StringName("property_from_list") && property_from_list != Vector3(42, 42, 42)) {
+	if (p_name == SNAME("property_from_list") && property_from_list != Vector3(42, 42, 42)) {
 		return true;
 	} else {
 		return false;
@@ -85,7 +87,7 @@ bool Example::_property_can_revert(const StringName &p_name) const {
 };
 
 bool Example::_property_get_revert(const StringName &p_name, Variant &r_property) const {
-	if (p_name == StringName("property_from_list")) {
+	if (p_name == SNAME("property_from_list")) {
 		r_property = Vector3(42, 42, 42);
 		return true;
 	} else {
@@ -106,6 +108,25 @@ void Example::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("test_tarray_arg", "array"), &Example::test_tarray_arg);
 	ClassDB::bind_method(D_METHOD("test_tarray"), &Example::test_tarray);
 	ClassDB::bind_method(D_METHOD("test_dictionary"), &Example::test_dictionary);
+	ClassDB::bind_method(D_METHOD("test_method_batch"), &Example::test_method_batch);
+	ClassDB::bind_method(D_METHOD("test_number_round_trip"), &Example::test_number_round_trip);
+	ClassDB::bind_method(D_METHOD("test_case_mapping"), &Example::test_case_mapping);
+	ClassDB::bind_method(D_METHOD("test_char_scanning"), &Example::test_char_scanning);
+	ClassDB::bind_method(D_METHOD("test_rope_benchmark"), &Example::test_rope_benchmark);
+	ClassDB::bind_method(D_METHOD("test_class_name_benchmark"), &Example::test_class_name_benchmark);
+	ClassDB::bind_method(D_METHOD("test_builtin_call_benchmark"), &Example::test_builtin_call_benchmark);
+	ClassDB::bind_method(D_METHOD("test_method_batch_benchmark"), &Example::test_method_batch_benchmark);
+	ClassDB::bind_method(D_METHOD("test_sname_benchmark"), &Example::test_sname_benchmark);
+	ClassDB::bind_method(D_METHOD("test_instantiation_benchmark"), &Example::test_instantiation_benchmark);
+	ClassDB::bind_method(D_METHOD("test_ref_return_benchmark"), &Example::test_ref_return_benchmark);
+	ClassDB::bind_method(D_METHOD("test_binding_cache_benchmark"), &Example::test_binding_cache_benchmark);
+	ClassDB::bind_method(D_METHOD("test_bind_benchmark"), &Example::test_bind_benchmark);
+	ClassDB::bind_method(D_METHOD("test_registration_benchmark"), &Example::test_registration_benchmark);
+	ClassDB::bind_method(D_METHOD("test_notification_benchmark"), &Example::test_notification_benchmark);
+	ClassDB::bind_method(D_METHOD("test_transcoding_benchmark"), &Example::test_transcoding_benchmark);
+	ClassDB::bind_method(D_METHOD("test_char_string_benchmark"), &Example::test_char_string_benchmark);
+	ClassDB::bind_method(D_METHOD("test_literal_benchmark"), &Example::test_literal_benchmark);
+	ClassDB::bind_method(D_METHOD("test_case_benchmark"), &Example::test_case_benchmark);
 
 	ClassDB::bind_method(D_METHOD("def_args", "a", "b"), &Example::def_args, DEFVAL(100), DEFVAL(200));
 
@@ -134,6 +155,9 @@ void Example::_bind_methods() {
 	}
 
 	// Properties.
+	// Listed by _get_property_list(), but set and read without going through _set()/_get().
+	BIND_PROPERTY_ACCESSOR("property_from_list", property_from_list);
+
 	ADD_GROUP("Test group", "group_");
 	ADD_SUBGROUP("Test subgroup", "group_subgroup_");
 
@@ -143,7 +167,7 @@ void Example::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::VECTOR2, "group_subgroup_custom_position"), "set_custom_position", "get_custom_position");
 
 	// Signals.
-	ADD_SIGNAL(MethodInfo("custom_signal", PropertyInfo(Variant::STRING, "name"), PropertyInfo(Variant::INT, "value")));
+	custom_signal.bind(get_class_static(), "name", "value");
 	ClassDB::bind_method(D_METHOD("emit_custom_signal", "name", "value"), &Example::emit_custom_signal);
 
 	// Constants.
@@ -155,6 +179,8 @@ void Example::_bind_methods() {
 
 Example::Example() {
 	UtilityFunctions::print("Constructor.");
+	// The property list never changes.
+	set_property_list_cached(true);
 }
 
 Example::~Example() {
@@ -212,7 +238,7 @@ void Example::varargs_func_void(const Variant **args, GDNativeInt arg_count, GDN
 }
 
 void Example::emit_custom_signal(const String &name, int value) {
-	emit_signal("custom_signal", name, value);
+	custom_signal.emit(this, name, value);
 }
 
 Array Example::test_array() const {
@@ -250,6 +276,934 @@ Dictionary Example::test_dictionary() const {
 	return dict;
 }
 
+Array Example::test_method_batch() const {
+	const uint32_t count = 4;
+	Object *controls[count];
+	bool visible[count];
+	bool results[count];
+	for (uint32_t i = 0; i < count; i++) {
+		controls[i] = memnew(Control);
+		visible[i] = i % 2 == 0;
+	}
+
+	Array ret;
+	MethodBatch set_visible = MAKE_METHOD_BATCH(CanvasItem, set_visible);
+	MethodBatch is_visible = MAKE_METHOD_BATCH(CanvasItem, is_visible);
+
+	// One value per object, then the same value for all of them.
+	set_visible.call_each(controls, visible, count);
+	is_visible.call_ret(controls, results, count);
+	for (uint32_t i = 0; i < count; i++) {
+		ret.push_back(results[i]);
+	}
+	set_visible.call(controls, count, true);
+	is_visible.call_ret(controls, results, count);
+	for (uint32_t i = 0; i < count; i++) {
+		ret.push_back(results[i]);
+	}
+
+	// The same with Refs, which are passed and returned as engine objects.
+	Ref<Material> material = memnew(CanvasItemMaterial);
+	Ref<Material> materials[count];
+	Ref<Material> material_results[count];
+	for (uint32_t i = 0; i < count; i++) {
+		if (i % 2 == 0) {
+			materials[i] = material;
+		}
+	}
+	MethodBatch set_material = MAKE_METHOD_BATCH(CanvasItem, set_material);
+	MethodBatch get_material = MAKE_METHOD_BATCH(CanvasItem, get_material);
+
+	set_material.call_each(controls, materials, count);
+	get_material.call_ret(controls, material_results, count);
+	for (uint32_t i = 0; i < count; i++) {
+		ret.push_back(material_results[i] == material);
+	}
+	set_material.call(controls, count, material);
+	get_material.call_ret(controls, material_results, count);
+	for (uint32_t i = 0; i < count; i++) {
+		ret.push_back(material_results[i] == material);
+		memdelete(controls[i]);
+	}
+	return ret;
+}
+
+// Returns how many numbers were formatted or parsed differently than by the engine.
+int Example::test_number_round_trip() const {
+	int failures = 0;
+
+	const int64_t ints[] = { 0, 1, -1, 42, -1234567, INT64_MAX, INT64_MIN + 1 };
+	for (int64_t value : ints) {
+		String str = itos(value);
+		if (str != String::num_int64(value) || String::to_int(str.ptr()) != value || str.to_int() != value) {
+			failures++;
+		}
+	}
+
+	const double reals[] = { 0.0, 1.5, -2.25, 0.1, 123456.789, 1e-7, -3e20 };
+	for (double value : reals) {
+		String str = rtos(value);
+		if (str != String::num(value) || String::to_float(str.ptr()) != value || str.to_float() != value) {
+			failures++;
+		}
+	}
+
+	// Text the engine doesn't read as a number isn't read as one here either.
+	const char32_t *texts[] = { U"--5", U"-+5", U"inf", U"-nan", U"0x1A", U" 7.5e2", U"12abc", U"." };
+	for (const char32_t *text : texts) {
+		if (String::to_float(text) != String(text).to_float()) {
+			failures++;
+		}
+	}
+
+	return failures;
+}
+
+int Example::test_case_mapping() const {
+	int failures = 0;
+
+	// Every code point, and some past the last one, against the engine's to_upper() and to_lower(). The
+	// characters are written through ptrw(), constructing the String would replace surrogates.
+	const int64_t chunk = 4096;
+	std::vector<char32_t> placeholder(chunk + 1, U'a');
+	placeholder[chunk] = 0;
+	std::vector<char32_t> upper(chunk);
+	std::vector<char32_t> lower(chunk);
+	for (int64_t base = 0; base < 0x111000; base += chunk) {
+		String text = placeholder.data();
+		char32_t *chars = text.ptrw();
+		for (int64_t i = 0; i < chunk; i++) {
+			chars[i] = char32_t(base + i);
+		}
+
+		String engine_upper = text.to_upper();
+		String engine_lower = text.to_lower();
+		to_upper_case(text.ptr(), upper.data(), chunk);
+		to_lower_case(text.ptr(), lower.data(), chunk);
+		for (int64_t i = 0; i < chunk; i++) {
+			int c = int(base + i);
+			failures += upper[i] != engine_upper.ptr()[i];
+			failures += lower[i] != engine_lower.ptr()[i];
+			failures += char32_t(_find_upper(c)) != engine_upper.ptr()[i];
+			failures += char32_t(_find_lower(c)) != engine_lower.ptr()[i];
+		}
+	}
+
+	// Converting in place, with a length that isn't a multiple of the 16 character blocks.
+	String text = U"Ünïcödé Straße, ΣΊΣΥΦΟΣ and plain ASCII text";
+	std::vector<char32_t> in_place(text.ptr(), text.ptr() + text.length());
+	to_upper_case(in_place.data(), in_place.data(), in_place.size());
+	failures += String(std::u32string(in_place.begin(), in_place.end()).c_str()) != text.to_upper();
+
+	return failures;
+}
+
+static int64_t _find_first_non_whitespace_loop(const char32_t *p_str, int64_t p_length) {
+	for (int64_t i = 0; i < p_length; i++) {
+		if (!is_whitespace(p_str[i])) {
+			return i;
+		}
+	}
+	return p_length;
+}
+
+static int64_t _find_first_of_loop(const char32_t *p_str, int64_t p_length, const char32_t *p_set, int64_t p_set_length) {
+	for (int64_t i = 0; i < p_length; i++) {
+		for (int64_t k = 0; k < p_set_length; k++) {
+			if (p_str[i] == p_set[k]) {
+				return i;
+			}
+		}
+	}
+	return p_length;
+}
+
+static int64_t _count_linebreaks_loop(const char32_t *p_str, int64_t p_length) {
+	int64_t count = 0;
+	for (int64_t i = 0; i < p_length; i++) {
+		count += is_linebreak(p_str[i]);
+	}
+	return count;
+}
+
+static bool _is_valid_identifier_loop(const char32_t *p_str, int64_t p_length) {
+	if (p_length <= 0 || is_digit(p_str[0])) {
+		return false;
+	}
+	for (int64_t i = 0; i < p_length; i++) {
+		if (!is_ascii_identifier_char(p_str[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+int Example::test_char_scanning() const {
+	int failures = 0;
+
+	// One odd character in a buffer of the same filler, at every position of buffers that end before, on and after
+	// the edges of the 16 character blocks the scanning functions work in.
+	const char32_t fillers[] = { ' ', '\n', 'a' };
+	const char32_t odd[] = {
+		' ', '\t', '\n', '\r', 0x000b, 0x000c, 0x0085, 0x00a0, 0x1680, 0x2000, 0x200a, 0x200b, 0x2028, 0x2029, 0x202f, 0x205f, 0x3000,
+		'a', 'z', 'A', 'Z', '0', '9', '_', '-', '/', ':', '@', '[', '`', '{', ',', ';', 0x00e9, 0x1f600
+	};
+	const char32_t set[] = { ',', ';', 0x2028, 0x1f600 };
+	const int64_t set_length = sizeof(set) / sizeof(set[0]);
+	std::vector<char32_t> buffer;
+	for (char32_t filler : fillers) {
+		for (int64_t length = 0; length <= 50; length++) {
+			for (char32_t c : odd) {
+				// The last position is past the end, leaving only the filler.
+				for (int64_t pos = 0; pos <= length; pos++) {
+					buffer.assign(length, filler);
+					if (pos < length) {
+						buffer[pos] = c;
+					}
+					const char32_t *str = buffer.data();
+					failures += find_first_non_whitespace(str, length) != _find_first_non_whitespace_loop(str, length);
+					failures += find_first_of(str, length, set, set_length) != _find_first_of_loop(str, length, set, set_length);
+					failures += find_first_of(str, length, set, 0) != length;
+					failures += count_linebreaks(str, length) != _count_linebreaks_loop(str, length);
+					failures += is_valid_identifier(str, length) != _is_valid_identifier_loop(str, length);
+				}
+			}
+		}
+	}
+
+	return failures;
+}
+
+static int64_t ticks_usec() {
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// What finding a line takes without a Rope: scanning the text for its '\n'.
+static String string_get_line(const String &p_string, int64_t p_line) {
+	const char32_t *chars = p_string.ptr();
+	int64_t length = p_string.length();
+	int64_t start = 0;
+	for (int64_t line = 0; line < p_line && start < length; start++) {
+		line += chars[start] == '\n';
+	}
+	int64_t end = start;
+	while (end < length && chars[end] != '\n') {
+		end++;
+	}
+	return p_string.substr(start, end - start);
+}
+
+// Edits and line lookups on a 10 MB document, in a Rope and in a String. Times are averages in microseconds.
+Dictionary Example::test_rope_benchmark() const {
+	const int64_t document_length = 10 * 1024 * 1024;
+	StringBuilder builder;
+	builder.reserve(document_length + 128);
+	for (int64_t line = 0; builder.get_string_length() < document_length; line++) {
+		builder.append("Line ").append_int(line).append(" of a large document, with some text to edit.\n");
+	}
+	String string = builder.as_string();
+	Rope rope(string);
+
+	// The same pseudo-random edits are made to both, inserting at even steps and erasing at odd ones.
+	const int count = 50;
+	int64_t positions[count];
+	uint64_t seed = 1;
+	int64_t length = string.length();
+	for (int i = 0; i < count; i++) {
+		seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+		positions[i] = int64_t((seed >> 33) % uint64_t(length - 16));
+		length += i % 2 == 0 ? 4 : -4;
+	}
+
+	int64_t start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		if (i % 2 == 0) {
+			rope.insert(positions[i], U"edit", 4);
+		} else {
+			rope.erase(positions[i], 4);
+		}
+	}
+	int64_t rope_edit = ticks_usec() - start;
+
+	start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		if (i % 2 == 0) {
+			string = string.insert(positions[i], "edit");
+		} else {
+			string = string.substr(0, positions[i]) + string.substr(positions[i] + 4, -1);
+		}
+	}
+	int64_t string_edit = ticks_usec() - start;
+
+	int64_t line_count = rope.get_line_count();
+	int64_t rope_line_length = 0;
+	int64_t string_line_length = 0;
+
+	start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		rope_line_length += rope.get_line(line_count * i / count).length();
+	}
+	int64_t rope_line = ticks_usec() - start;
+
+	start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		string_line_length += string_get_line(string, line_count * i / count).length();
+	}
+	int64_t string_line = ticks_usec() - start;
+
+	Dictionary dict;
+	dict["matches"] = rope.as_string() == string && rope_line_length == string_line_length;
+	dict["rope_edit_usec"] = double(rope_edit) / count;
+	dict["string_edit_usec"] = double(string_edit) / count;
+	dict["rope_line_usec"] = double(rope_line) / count;
+	dict["string_line_usec"] = double(string_line) / count;
+	return dict;
+}
+
+// How class names used to be read, through a function-local static and its initialization guard.
+static const StringName &guarded_class_name() {
+	static StringName name = "Example";
+	return name;
+}
+
+// Reading the class name and casting to it in a hot loop. Times are averages in nanoseconds.
+Dictionary Example::test_class_name_benchmark() const {
+	const int count = 1000000;
+	const Object *object = this;
+	const StringName *volatile name_sink = nullptr;
+	int64_t casts = 0;
+
+	int64_t start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		name_sink = &Example::get_class_static();
+	}
+	int64_t class_static = ticks_usec() - start;
+
+	start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		name_sink = &guarded_class_name();
+	}
+	int64_t guarded_static = ticks_usec() - start;
+
+	start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		casts += Object::cast_to<Example>(object) != nullptr;
+	}
+	int64_t cast_to = ticks_usec() - start;
+
+	Dictionary dict;
+	dict["casts"] = casts;
+	dict["get_class_static_nsec"] = double(class_static) * 1000 / count;
+	dict["guarded_static_nsec"] = double(guarded_static) * 1000 / count;
+	dict["cast_to_nsec"] = double(cast_to) * 1000 / count;
+	return dict;
+}
+
+// Builtin method calls on String and Array, returning trivial and non-trivial values. The "assigned" loops
+// repeat the calls the way results used to be produced, into a default constructed value that is then assigned.
+// Times are averages in nanoseconds.
+Dictionary Example::test_builtin_call_benchmark() const {
+	const int count = 100000;
+	String string = "The quick brown fox jumps over the lazy dog";
+	Array array;
+	for (int i = 0; i < 16; i++) {
+		array.push_back(i);
+	}
+	int64_t total = 0;
+
+	int64_t start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		total += string.length();
+	}
+	int64_t string_length = ticks_usec() - start;
+
+	start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		String sub = string.substr(4, 5);
+		total += sub.length();
+	}
+	int64_t string_substr = ticks_usec() - start;
+
+	start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		String sub;
+		sub = string.substr(4, 5);
+		total += sub.length();
+	}
+	int64_t string_substr_assigned = ticks_usec() - start;
+
+	start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		total += array.size();
+	}
+	int64_t array_size = ticks_usec() - start;
+
+	start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		Array copy = array.duplicate(false);
+		total += copy.size();
+	}
+	int64_t array_duplicate = ticks_usec() - start;
+
+	start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		Array copy;
+		copy = array.duplicate(false);
+		total += copy.size();
+	}
+	int64_t array_duplicate_assigned = ticks_usec() - start;
+
+	Dictionary dict;
+	dict["total"] = total;
+	dict["string_length_nsec"] = double(string_length) * 1000 / count;
+	dict["string_substr_nsec"] = double(string_substr) * 1000 / count;
+	dict["string_substr_assigned_nsec"] = double(string_substr_assigned) * 1000 / count;
+	dict["array_size_nsec"] = double(array_size) * 1000 / count;
+	dict["array_duplicate_nsec"] = double(array_duplicate) * 1000 / count;
+	dict["array_duplicate_assigned_nsec"] = double(array_duplicate_assigned) * 1000 / count;
+	return dict;
+}
+
+// MethodBatch against calling the generated wrapper once per object. Times are averages per call in nanoseconds.
+Dictionary Example::test_method_batch_benchmark() const {
+	const uint32_t count = 1000;
+	const int rounds = 100;
+	Control *controls[count];
+	Object *objects[count];
+	bool visible[count];
+	bool results[count];
+	for (uint32_t i = 0; i < count; i++) {
+		controls[i] = memnew(Control);
+		objects[i] = controls[i];
+		visible[i] = i % 2 == 0;
+	}
+	MethodBatch set_visible = MAKE_METHOD_BATCH(CanvasItem, set_visible);
+	MethodBatch is_visible = MAKE_METHOD_BATCH(CanvasItem, is_visible);
+	int64_t visible_count = 0;
+
+	int64_t start = ticks_usec();
+	for (int round = 0; round < rounds; round++) {
+		for (uint32_t i = 0; i < count; i++) {
+			controls[i]->set_visible(visible[i]);
+		}
+	}
+	int64_t loop_set = ticks_usec() - start;
+
+	start = ticks_usec();
+	for (int round = 0; round < rounds; round++) {
+		set_visible.call_each(objects, visible, count);
+	}
+	int64_t batch_set = ticks_usec() - start;
+
+	start = ticks_usec();
+	for (int round = 0; round < rounds; round++) {
+		for (uint32_t i = 0; i < count; i++) {
+			visible_count += controls[i]->is_visible();
+		}
+	}
+	int64_t loop_get = ticks_usec() - start;
+
+	start = ticks_usec();
+	for (int round = 0; round < rounds; round++) {
+		is_visible.call_ret(objects, results, count);
+		for (uint32_t i = 0; i < count; i++) {
+			visible_count += results[i];
+		}
+	}
+	int64_t batch_get = ticks_usec() - start;
+
+	for (uint32_t i = 0; i < count; i++) {
+		memdelete(controls[i]);
+	}
+
+	const double calls = double(count) * rounds;
+	Dictionary dict;
+	dict["visible_count"] = visible_count;
+	dict["loop_set_nsec"] = double(loop_set) * 1000 / calls;
+	dict["batch_set_nsec"] = double(batch_set) * 1000 / calls;
+	dict["loop_get_nsec"] = double(loop_get) * 1000 / calls;
+	dict["batch_get_nsec"] = double(batch_get) * 1000 / calls;
+	return dict;
+}
+
+// Calls and signal emissions naming the method or signal with a literal, converted to a StringName on every
+// call, or with SNAME(), interned once. Times are averages in nanoseconds.
+Dictionary Example::test_sname_benchmark() {
+	const int count = 100000;
+	int64_t total = 0;
+
+	int64_t start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		StringName name = "get_instance_id";
+		total += name == SNAME("get_instance_id");
+	}
+	int64_t literal_name = ticks_usec() - start;
+
+	start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		const StringName &name = SNAME("get_instance_id");
+		total += name == SNAME("get_instance_id");
+	}
+	int64_t sname_name = ticks_usec() - start;
+
+	start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		total += int64_t(call("get_instance_id")) == int64_t(get_instance_id());
+	}
+	int64_t literal_call = ticks_usec() - start;
+
+	start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		total += int64_t(call(SNAME("get_instance_id"))) == int64_t(get_instance_id());
+	}
+	int64_t sname_call = ticks_usec() - start;
+
+	// Nothing is connected to this signal, so only the emission itself is measured.
+	start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		emit_signal("item_rect_changed");
+	}
+	int64_t literal_emit = ticks_usec() - start;
+
+	start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		emit_signal(SNAME("item_rect_changed"));
+	}
+	int64_t sname_emit = ticks_usec() - start;
+
+	Dictionary dict;
+	dict["total"] = total;
+	dict["literal_name_nsec"] = double(literal_name) * 1000 / count;
+	dict["sname_name_nsec"] = double(sname_name) * 1000 / count;
+	dict["literal_call_nsec"] = double(literal_call) * 1000 / count;
+	dict["sname_call_nsec"] = double(sname_call) * 1000 / count;
+	dict["literal_emit_nsec"] = double(literal_emit) * 1000 / count;
+	dict["sname_emit_nsec"] = double(sname_emit) * 1000 / count;
+	return dict;
+}
+
+// Spawning extension nodes in bulk. Entering the tree makes the engine resolve the class's virtual methods
+// for every new instance, through ClassDB::get_virtual_func(). Times are averages per node in microseconds.
+Dictionary Example::test_instantiation_benchmark() {
+	const int count = 10000;
+	int64_t children = 0;
+
+	int64_t start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		memdelete(memnew(ExampleMin));
+	}
+	int64_t instantiate = ticks_usec() - start;
+
+	// Spawned under a container of their own, so this node isn't notified of every child.
+	Node *container = memnew(Node);
+	add_child(container, false, Node::INTERNAL_MODE_DISABLED);
+	std::vector<ExampleMin *> nodes(count);
+	start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		nodes[i] = memnew(ExampleMin);
+		container->add_child(nodes[i], false, Node::INTERNAL_MODE_DISABLED);
+	}
+	children = container->get_child_count(false);
+	for (int i = 0; i < count; i++) {
+		container->remove_child(nodes[i]);
+		memdelete(nodes[i]);
+	}
+	int64_t spawn = ticks_usec() - start;
+	remove_child(container);
+	memdelete(container);
+
+	Dictionary dict;
+	dict["spawned"] = children == count;
+	dict["instantiate_usec"] = double(instantiate) / count;
+	dict["spawn_usec"] = double(spawn) / count;
+	return dict;
+}
+
+Dictionary Example::test_ref_return_benchmark() {
+	const int count = 100000;
+	int64_t total = 0;
+
+	Ref<Material> previous = get_material();
+	Ref<Material> material = memnew(CanvasItemMaterial);
+	set_material(material);
+	int64_t references = material->get_reference_count();
+
+	// Same ptrcall without an object in the return, the floor for the loops below.
+	int64_t start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		total += get_instance_id() != 0;
+	}
+	int64_t plain = ticks_usec() - start;
+
+	// Generated wrapper: one binding lookup, the Ref adopts the reference the engine returned.
+	start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		Ref<Material> returned = get_material();
+		total += returned == material;
+	}
+	int64_t ref_return = ticks_usec() - start;
+
+	// The same Ref through a Variant, which goes through Object::cast_to() and takes its own reference.
+	start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		Ref<Material> returned = call(SNAME("get_material"));
+		total += returned == material;
+	}
+	int64_t variant_return = ticks_usec() - start;
+
+	bool refcount_unchanged = material->get_reference_count() == references;
+	set_material(previous);
+
+	Dictionary dict;
+	dict["total"] = total;
+	dict["refcount_unchanged"] = refcount_unchanged;
+	dict["plain_nsec"] = double(plain) * 1000 / count;
+	dict["ref_return_nsec"] = double(ref_return) * 1000 / count;
+	dict["variant_return_nsec"] = double(variant_return) * 1000 / count;
+	return dict;
+}
+
+Dictionary Example::test_binding_cache_benchmark() const {
+	const int child_count = 32;
+	const int rounds = 10000;
+	int64_t total = 0;
+
+	Node *container = memnew(Node);
+	Node *nodes[child_count];
+	for (int i = 0; i < child_count; i++) {
+		nodes[i] = memnew(Node);
+		container->add_child(nodes[i], false, Node::INTERNAL_MODE_DISABLED);
+	}
+
+	// Fetching the same children over and over, as code walking the tree every frame does.
+	internal::InstanceBindingCache::reset_stats();
+	int64_t start = ticks_usec();
+	for (int r = 0; r < rounds; r++) {
+		for (int i = 0; i < child_count; i++) {
+			total += container->get_child(i, false) == nodes[i];
+		}
+	}
+	int64_t get_child = ticks_usec() - start;
+	internal::InstanceBindingCache::Stats stats = internal::InstanceBindingCache::get_stats();
+
+	// The lookup alone, through the cache and straight from the engine.
+	start = ticks_usec();
+	for (int r = 0; r < rounds; r++) {
+		for (int i = 0; i < child_count; i++) {
+			total += internal::InstanceBindingCache::get(nodes[i]->_owner, &Node::___binding_callbacks) == nodes[i];
+		}
+	}
+	int64_t cached = ticks_usec() - start;
+
+	start = ticks_usec();
+	for (int r = 0; r < rounds; r++) {
+		for (int i = 0; i < child_count; i++) {
+			total += internal::gdn_interface->object_get_instance_binding(nodes[i]->_owner, internal::token, &Node::___binding_callbacks) == nodes[i];
+		}
+	}
+	int64_t uncached = ticks_usec() - start;
+
+	for (int i = 0; i < child_count; i++) {
+		container->remove_child(nodes[i]);
+		memdelete(nodes[i]);
+	}
+	memdelete(container);
+
+	const int count = child_count * rounds;
+	Dictionary dict;
+	dict["total"] = total;
+	// Counted in builds with DEBUG_ENABLED only.
+	dict["hit_rate"] = stats.hits + stats.misses > 0 ? double(stats.hits) / double(stats.hits + stats.misses) : 0.0;
+	dict["wrapper_allocations"] = stats.wrapper_allocations;
+	dict["get_child_nsec"] = double(get_child) * 1000 / count;
+	dict["cached_lookup_nsec"] = double(cached) * 1000 / count;
+	dict["engine_lookup_nsec"] = double(uncached) * 1000 / count;
+	return dict;
+}
+
+Dictionary Example::test_bind_benchmark() const {
+	// The methods were bound when the extension was loaded, this only collects the timings.
+	const StringName &class_name = ExampleManyMethods::get_class_static();
+	int64_t registration = ClassDB::get_registration_time_usec(class_name);
+
+	Dictionary dict;
+	dict["bound"] = ClassDB::get_method(class_name, "method_0") != nullptr && ClassDB::get_method(class_name, "method_" + itos(ExampleManyMethods::METHOD_COUNT - 1)) != nullptr;
+	dict["bind_usec"] = ExampleManyMethods::bind_usec;
+	dict["registration_usec"] = registration;
+	dict["per_method_nsec"] = double(registration) * 1000 / ExampleManyMethods::METHOD_COUNT;
+	return dict;
+}
+
+Dictionary Example::test_registration_benchmark() const {
+	const StringName classes[] = {
+		ExampleRef::get_class_static(),
+		ExampleMin::get_class_static(),
+		Example::get_class_static(),
+		ExampleVirtual::get_class_static(),
+		ExampleAbstract::get_class_static(),
+		ExampleManyMethods::get_class_static(),
+	};
+
+	Dictionary per_class;
+	int64_t total = 0;
+	for (const StringName &class_name : classes) {
+		int64_t usec = ClassDB::get_registration_time_usec(class_name);
+		per_class[class_name] = usec;
+		total += usec;
+	}
+
+	Dictionary dict;
+	dict["classes"] = per_class.size();
+	dict["per_class_usec"] = per_class;
+	dict["total_usec"] = total;
+	return dict;
+}
+
+Dictionary Example::test_notification_benchmark() const {
+	const int count = 100000;
+
+	ExampleNotifyBase *shallow = memnew(ExampleNotifyBase);
+	ExampleNotify4 *deep = memnew(ExampleNotify4);
+	ExampleNotifyFiltered *filtered = memnew(ExampleNotifyFiltered);
+
+	int64_t start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		shallow->notification(ExampleNotifyBase::NOTIFICATION_EXAMPLE);
+	}
+	int64_t shallow_time = ticks_usec() - start;
+
+	// Four classes between the instance and the _notification() that handles it.
+	start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		deep->notification(ExampleNotifyBase::NOTIFICATION_EXAMPLE);
+	}
+	int64_t deep_time = ticks_usec() - start;
+
+	// Dropped by the filter before reaching _notification().
+	start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		filtered->notification(ExampleNotifyBase::NOTIFICATION_EXAMPLE + 1);
+	}
+	int64_t filtered_time = ticks_usec() - start;
+
+	int64_t received = shallow->received + deep->received + filtered->received;
+	memdelete(shallow);
+	memdelete(deep);
+	memdelete(filtered);
+
+	Dictionary dict;
+	dict["received"] = received;
+	dict["shallow_nsec"] = double(shallow_time) * 1000 / count;
+	dict["deep_nsec"] = double(deep_time) * 1000 / count;
+	dict["filtered_nsec"] = double(filtered_time) * 1000 / count;
+	return dict;
+}
+
+Dictionary Example::test_transcoding_benchmark() const {
+	const int count = 100000;
+	const String texts[2] = {
+		"GET /api/v1/players?sort=score&limit=50 HTTP/1.1 Host: example.org",
+		U"Joueur « Zoë » a rejoint la partie, 得分 1250 点 🎮 prêt à jouer !",
+	};
+	const char *names[2] = { "ascii", "mixed" };
+
+	Dictionary dict;
+	bool matches = true;
+	for (int t = 0; t < 2; t++) {
+		const String &text = texts[t];
+
+		// What utf8() did before: ask the engine for the size, then again for the data.
+		int64_t two_pass_bytes = 0;
+		int64_t start = ticks_usec();
+		for (int i = 0; i < count; i++) {
+			int64_t size = internal::gdn_interface->string_to_utf8_chars(text._native_ptr(), nullptr, 0);
+			char *cstr = memnew_arr(char, size + 1);
+			internal::gdn_interface->string_to_utf8_chars(text._native_ptr(), cstr, size + 1);
+			cstr[size] = '\0';
+			two_pass_bytes += size;
+			memdelete_arr(cstr);
+		}
+		int64_t two_pass = ticks_usec() - start;
+
+		int64_t utf8_bytes = 0;
+		start = ticks_usec();
+		for (int i = 0; i < count; i++) {
+			utf8_bytes += text.utf8().length();
+		}
+		int64_t utf8 = ticks_usec() - start;
+
+		// One buffer for every conversion, as a logger or serializer would keep.
+		std::vector<char> buffer(text.length() * 4 + 1);
+		int64_t into_bytes = 0;
+		start = ticks_usec();
+		for (int i = 0; i < count; i++) {
+			into_bytes += text.utf8_into(buffer.data(), buffer.size());
+		}
+		int64_t into = ticks_usec() - start;
+
+		// Not only the sizes, the bytes have to match the engine's encoding too.
+		{
+			int64_t size = internal::gdn_interface->string_to_utf8_chars(text._native_ptr(), nullptr, 0);
+			std::vector<char> engine_buffer(size + 1);
+			internal::gdn_interface->string_to_utf8_chars(text._native_ptr(), engine_buffer.data(), size + 1);
+			engine_buffer[size] = '\0';
+			matches = matches && strcmp(engine_buffer.data(), text.utf8().get_data()) == 0 && strcmp(engine_buffer.data(), buffer.data()) == 0;
+		}
+		matches = matches && two_pass_bytes == utf8_bytes && utf8_bytes == into_bytes;
+		dict[String(names[t]) + "_two_pass_nsec"] = double(two_pass) * 1000 / count;
+		dict[String(names[t]) + "_utf8_nsec"] = double(utf8) * 1000 / count;
+		dict[String(names[t]) + "_utf8_into_nsec"] = double(into) * 1000 / count;
+	}
+	dict["matches"] = matches;
+	return dict;
+}
+
+Dictionary Example::test_char_string_benchmark() const {
+	const int rounds = 20000;
+	// Node names, property names, paths and log tags, 5 to 30 characters.
+	const String names[] = {
+		"Label",
+		"position",
+		"custom_signal",
+		"theme_override_colors",
+		"Player/Camera3D",
+		"res://icon.png",
+		"group_subgroup_custom_position",
+		"[network]",
+	};
+	const int name_count = sizeof(names) / sizeof(names[0]);
+	const int count = rounds * name_count;
+	int64_t total = 0;
+	int64_t inline_count = 0;
+
+	int64_t start = ticks_usec();
+	for (int r = 0; r < rounds; r++) {
+		for (const String &name : names) {
+			CharString utf8 = name.utf8();
+			total += utf8.length();
+			inline_count += utf8.is_inline();
+		}
+	}
+	int64_t convert = ticks_usec() - start;
+
+	// The same conversion into a heap buffer allocated for every string, as CharString always did before.
+	start = ticks_usec();
+	for (int r = 0; r < rounds; r++) {
+		for (const String &name : names) {
+			int64_t capacity = name.length() * 4 + 1;
+			char *cstr = memnew_arr(char, capacity);
+			total += name.utf8_into(cstr, capacity);
+			memdelete_arr(cstr);
+		}
+	}
+	int64_t heap = ticks_usec() - start;
+
+	CharString converted[name_count];
+	for (int i = 0; i < name_count; i++) {
+		converted[i] = names[i].utf8();
+	}
+	start = ticks_usec();
+	for (int r = 0; r < rounds; r++) {
+		for (const CharString &utf8 : converted) {
+			CharString copy = utf8;
+			total += copy.length();
+		}
+	}
+	int64_t copy = ticks_usec() - start;
+
+	Dictionary dict;
+	dict["total"] = total;
+	dict["inline"] = inline_count == count;
+	dict["convert_nsec"] = double(convert) * 1000 / count;
+	dict["heap_nsec"] = double(heap) * 1000 / count;
+	dict["copy_nsec"] = double(copy) * 1000 / count;
+	return dict;
+}
+
+Dictionary Example::test_literal_benchmark() const {
+	const int count = 100000;
+	const String name = "custom_position";
+	int64_t total = 0;
+
+	// What the operators did before: turn the literal into a String through the engine first.
+	int64_t start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		total += name == String("custom_position");
+		total += name != String("custom_rotation");
+	}
+	int64_t compare_temporary = ticks_usec() - start;
+
+	start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		total += name == "custom_position";
+		total += name != "custom_rotation";
+	}
+	int64_t compare_literal = ticks_usec() - start;
+
+	start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		total += (name + String("_changed")).length();
+	}
+	int64_t concat_temporary = ticks_usec() - start;
+
+	start = ticks_usec();
+	for (int i = 0; i < count; i++) {
+		total += (name + "_changed").length();
+	}
+	int64_t concat_literal = ticks_usec() - start;
+
+	Dictionary dict;
+	dict["total"] = total;
+	dict["compare_temporary_nsec"] = double(compare_temporary) * 1000 / (count * 2);
+	dict["compare_literal_nsec"] = double(compare_literal) * 1000 / (count * 2);
+	dict["concat_temporary_nsec"] = double(concat_temporary) * 1000 / count;
+	dict["concat_literal_nsec"] = double(concat_literal) * 1000 / count;
+	return dict;
+}
+
+Dictionary Example::test_case_benchmark() const {
+	const int count = 20000;
+	const String ascii = "Some plain ASCII text, the kind most identifiers and file paths are made of.";
+	const String mixed = U"Ünïcödé Straße, ΣΊΣΥΦΟΣ, Кириллица and some plain ASCII text in between.";
+	std::vector<char32_t> loop_out(mixed.length() > ascii.length() ? mixed.length() : ascii.length());
+	std::vector<char32_t> span_out(loop_out.size());
+	int64_t mismatches = 0;
+
+	int64_t times[4];
+	const String *texts[2] = { &ascii, &mixed };
+	for (int t = 0; t < 2; t++) {
+		const char32_t *src = texts[t]->ptr();
+		const int64_t length = texts[t]->length();
+
+		// What callers did before: look up every character on its own.
+		int64_t start = ticks_usec();
+		for (int i = 0; i < count; i++) {
+			for (int64_t j = 0; j < length; j++) {
+				loop_out[j] = _find_upper(src[j]);
+			}
+		}
+		times[t * 2] = ticks_usec() - start;
+
+		start = ticks_usec();
+		for (int i = 0; i < count; i++) {
+			to_upper_case(src, span_out.data(), length);
+		}
+		times[t * 2 + 1] = ticks_usec() - start;
+
+		for (int64_t j = 0; j < length; j++) {
+			mismatches += loop_out[j] != span_out[j];
+		}
+	}
+
+	Dictionary dict;
+	dict["mismatches"] = mismatches;
+	dict["ascii_loop_nsec"] = double(times[0]) * 1000 / (count * ascii.length());
+	dict["ascii_span_nsec"] = double(times[1]) * 1000 / (count * ascii.length());
+	dict["mixed_loop_nsec"] = double(times[2]) * 1000 / (count * mixed.length());
+	dict["mixed_span_nsec"] = double(times[3]) * 1000 / (count * mixed.length());
+	return dict;
+}
+
 // Properties.
 void Example::set_custom_position(const Vector2 &pos) {
 	custom_position = pos;
@@ -270,3 +1224,20 @@ bool Example::_has_point(const Vector2 &point) const {
 
 	return false;
 }
+
+void ExampleManyMethods::_bind_methods() {
+	int64_t start = ticks_usec();
+	for (int i = 0; i < METHOD_COUNT; i++) {
+		StringName name = "method_" + itos(i);
+		if (i % 2) {
+			ClassDB::bind_method(D_METHOD(name, "a", "b"), &ExampleManyMethods::add, DEFVAL(1));
+		} else {
+			ClassDB::bind_method(D_METHOD(name), &ExampleManyMethods::nop);
+		}
+	}
+	bind_usec = ticks_usec() - start;
+}
+
+void ExampleNotifyFiltered::_bind_methods() {
+	ClassDB::set_notification_filter(get_class_static(), { NOTIFICATION_EXAMPLE });
+}
@@ -19,6 +19,8 @@
 #include <godot_cpp/classes/viewport.hpp>
 
 #include <godot_cpp/core/binder_common.hpp>
+#include <godot_cpp/core/method_batch.hpp>
+#include <godot_cpp/core/typed_signal.hpp>
 
 using namespace godot;
 
@@ -60,6 +62,8 @@ private:
 	Vector3 property_from_list;
 	Vector2 dprop[3];
 
+	static inline TypedSignal<String, int> custom_signal{ "custom_signal" };
+
 public:
 	// Constants.
 	enum Constants {
@@ -91,6 +95,25 @@ public:
 	void test_tarray_arg(const TypedArray<int64_t> &p_array);
 	TypedArray<Vector2> test_tarray() const;
 	Dictionary test_dictionary() const;
+	Array test_method_batch() const;
+	int test_number_round_trip() const;
+	int test_case_mapping() const;
+	int test_char_scanning() const;
+	Dictionary test_rope_benchmark() const;
+	Dictionary test_class_name_benchmark() const;
+	Dictionary test_builtin_call_benchmark() const;
+	Dictionary test_method_batch_benchmark() const;
+	Dictionary test_sname_benchmark();
+	Dictionary test_instantiation_benchmark();
+	Dictionary test_ref_return_benchmark();
+	Dictionary test_binding_cache_benchmark() const;
+	Dictionary test_bind_benchmark() const;
+	Dictionary test_registration_benchmark() const;
+	Dictionary test_notification_benchmark() const;
+	Dictionary test_transcoding_benchmark() const;
+	Dictionary test_char_string_benchmark() const;
+	Dictionary test_literal_benchmark() const;
+	Dictionary test_case_benchmark() const;
 
 	// Property.
 	void set_custom_position(const Vector2 &pos);
@@ -121,4 +144,74 @@ protected:
 	static void _bind_methods() {}
 };
 
+// Binds a large number of methods, to measure registration time. See Example::test_bind_benchmark().
+class ExampleManyMethods : public Object {
+	GDCLASS(ExampleManyMethods, Object);
+
+protected:
+	static void _bind_methods();
+
+public:
+	static constexpr int METHOD_COUNT = 5000;
+	static inline int64_t bind_usec = 0;
+
+	void nop() {}
+	int64_t add(int64_t p_a, int64_t p_b) const { return p_a + p_b; }
+};
+
+// Five levels of extension classes where only the base handles notifications. See Example::test_notification_benchmark().
+class ExampleNotifyBase : public Object {
+	GDCLASS(ExampleNotifyBase, Object);
+
+protected:
+	static void _bind_methods() {}
+
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_EXAMPLE) {
+			received++;
+		}
+	}
+
+public:
+	static constexpr int NOTIFICATION_EXAMPLE = 9000;
+
+	int64_t received = 0;
+};
+
+class ExampleNotify1 : public ExampleNotifyBase {
+	GDCLASS(ExampleNotify1, ExampleNotifyBase);
+
+protected:
+	static void _bind_methods() {}
+};
+
+class ExampleNotify2 : public ExampleNotify1 {
+	GDCLASS(ExampleNotify2, ExampleNotify1);
+
+protected:
+	static void _bind_methods() {}
+};
+
+class ExampleNotify3 : public ExampleNotify2 {
+	GDCLASS(ExampleNotify3, ExampleNotify2);
+
+protected:
+	static void _bind_methods() {}
+};
+
+class ExampleNotify4 : public ExampleNotify3 {
+	GDCLASS(ExampleNotify4, ExampleNotify3);
+
+protected:
+	static void _bind_methods() {}
+};
+
+// Only lets NOTIFICATION_EXAMPLE through to the base's _notification().
+class ExampleNotifyFiltered : public ExampleNotify4 {
+	GDCLASS(ExampleNotifyFiltered, ExampleNotify4);
+
+protected:
+	static void _bind_methods();
+};
+
 #endif // EXAMPLE_CLASS_H
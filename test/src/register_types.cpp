@@ -21,11 +21,18 @@ void initialize_example_module(ModuleInitializationLevel p_level) {
 		return;
 	}
 
-	ClassDB::register_class<ExampleRef>();
+	ClassDB::register_pooled_class<ExampleRef>();
 	ClassDB::register_class<ExampleMin>();
 	ClassDB::register_class<Example>();
 	ClassDB::register_class<ExampleVirtual>(true);
 	ClassDB::register_abstract_class<ExampleAbstract>();
+	ClassDB::register_class<ExampleManyMethods>();
+	ClassDB::register_class<ExampleNotifyBase>();
+	ClassDB::register_class<ExampleNotify1>();
+	ClassDB::register_class<ExampleNotify2>();
+	ClassDB::register_class<ExampleNotify3>();
+	ClassDB::register_class<ExampleNotify4>();
+	ClassDB::register_class<ExampleNotifyFiltered>();
 }
 
 void uninitialize_example_module(ModuleInitializationLevel p_level) {